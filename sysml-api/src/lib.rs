@@ -11,43 +11,136 @@
 //! - `GET /projects/:id/commits` - List commits for a project
 //! - `GET /projects/:id/commits/:commit/model` - Get model snapshot
 //! - `POST /projects/:id/commits/:commit/model` - Store model snapshot
+//! - `GET /projects/:id/commits/:commit/elements` - Paginated elements (by kind)
+//! - `GET /projects/:id/commits/:commit/elements/stream` - Stream elements as NDJSON
+//! - `GET /projects/:id/commits/:commit/elements/:element/children` - Paginated children
+//! - `GET /projects/:id/commits/:commit/relationships` - Paginated relationships (by kind)
 
+use std::collections::{HashMap, VecDeque};
 use std::sync::Arc;
 use tokio::sync::RwLock;
 
 use axum::{
+    body::Bytes,
     extract::{Path, State},
-    http::StatusCode,
+    http::{HeaderMap, StatusCode},
     response::IntoResponse,
     routing::{get, post},
     Json, Router,
 };
 use serde::{Deserialize, Serialize};
 
-use sysml_canon::{from_json_str, to_json_string};
-use sysml_core::ModelGraph;
-use sysml_id::{CommitId, ProjectId};
+use sysml_canon::{content_hash, from_json_str, to_json_string};
+use sysml_core::{ElementKind, ModelGraph, RelationshipKind};
+use sysml_id::{CommitId, ElementId, ProjectId};
 use sysml_store::{InMemoryStore, SnapshotMeta, Store, StoreError};
 
+/// Default number of materialized models kept in the response cache.
+const DEFAULT_MODEL_CACHE_CAPACITY: usize = 16;
+
+/// A cached, fully materialized model response.
+///
+/// Models are immutable per commit, so once a (project, commit) pair has
+/// been served we keep the deserialized graph, the serialized response
+/// body (served as a cheap byte-slice clone), and the ETag derived from
+/// the graph's content hash.
+#[derive(Clone)]
+struct CachedModel {
+    graph: Arc<ModelGraph>,
+    body: Bytes,
+    etag: String,
+}
+
+/// A small LRU cache of materialized models keyed by (project, commit).
+struct ModelCache {
+    capacity: usize,
+    entries: HashMap<(String, String), CachedModel>,
+    /// Keys in least-recently-used-first order.
+    order: VecDeque<(String, String)>,
+}
+
+impl ModelCache {
+    fn new(capacity: usize) -> Self {
+        ModelCache {
+            capacity,
+            entries: HashMap::new(),
+            order: VecDeque::new(),
+        }
+    }
+
+    /// Look up an entry and mark it as most recently used.
+    fn get(&mut self, key: &(String, String)) -> Option<CachedModel> {
+        let entry = self.entries.get(key)?.clone();
+        if let Some(pos) = self.order.iter().position(|k| k == key) {
+            self.order.remove(pos);
+        }
+        self.order.push_back(key.clone());
+        Some(entry)
+    }
+
+    /// Insert an entry, evicting the least recently used past capacity.
+    fn insert(&mut self, key: (String, String), entry: CachedModel) {
+        if self.entries.insert(key.clone(), entry).is_none() {
+            self.order.push_back(key);
+        }
+        while self.entries.len() > self.capacity {
+            let Some(oldest) = self.order.pop_front() else {
+                break;
+            };
+            self.entries.remove(&oldest);
+        }
+    }
+
+    /// Drop an entry (e.g., after its commit is rewritten).
+    fn remove(&mut self, key: &(String, String)) {
+        if self.entries.remove(key).is_some() {
+            if let Some(pos) = self.order.iter().position(|k| k == key) {
+                self.order.remove(pos);
+            }
+        }
+    }
+}
+
 /// Application state.
 pub struct AppState {
     store: RwLock<InMemoryStore>,
+    model_cache: RwLock<ModelCache>,
 }
 
 impl AppState {
     /// Create new application state with an empty store.
     pub fn new() -> Self {
-        AppState {
-            store: RwLock::new(InMemoryStore::new()),
-        }
+        Self::with_store(InMemoryStore::new())
     }
 
     /// Create application state with an existing store.
     pub fn with_store(store: InMemoryStore) -> Self {
         AppState {
             store: RwLock::new(store),
+            model_cache: RwLock::new(ModelCache::new(DEFAULT_MODEL_CACHE_CAPACITY)),
         }
     }
+
+    /// Create application state with a custom model cache capacity.
+    pub fn with_cache_capacity(store: InMemoryStore, capacity: usize) -> Self {
+        AppState {
+            store: RwLock::new(store),
+            model_cache: RwLock::new(ModelCache::new(capacity)),
+        }
+    }
+
+    /// Get the cached materialized graph for a commit, if present.
+    ///
+    /// Lets in-process callers reuse the graph a `get_model` request
+    /// already deserialized instead of re-parsing the snapshot.
+    pub async fn cached_graph(&self, project: &str, commit: &str) -> Option<Arc<ModelGraph>> {
+        let key = (project.to_string(), commit.to_string());
+        self.model_cache
+            .write()
+            .await
+            .get(&key)
+            .map(|entry| entry.graph)
+    }
 }
 
 impl Default for AppState {
@@ -163,53 +256,367 @@ async fn list_commits(
     }
 }
 
-/// Get a model snapshot.
-async fn get_model(
-    State(state): State<Arc<AppState>>,
-    Path((project_id, commit_id)): Path<(String, String)>,
-) -> impl IntoResponse {
+/// Build the response for a cached model, honoring If-None-Match.
+fn cached_model_response(entry: &CachedModel, headers: &HeaderMap) -> axum::response::Response {
+    let if_none_match = headers
+        .get("if-none-match")
+        .and_then(|value| value.to_str().ok());
+    if if_none_match == Some(entry.etag.as_str()) {
+        return (StatusCode::NOT_MODIFIED, [("etag", entry.etag.clone())]).into_response();
+    }
+
+    (
+        StatusCode::OK,
+        [
+            ("content-type", "application/json".to_string()),
+            ("etag", entry.etag.clone()),
+        ],
+        entry.body.clone(),
+    )
+        .into_response()
+}
+
+/// Materialize a commit's model, going through the LRU cache.
+///
+/// On a miss the snapshot is loaded, deserialized, serialized once into
+/// the cached response body, and inserted; element-granular handlers share
+/// the same materialized graphs as `get_model`. Errors come back as
+/// ready-made responses.
+async fn materialize_model(
+    state: &AppState,
+    project_id: &str,
+    commit_id: &str,
+) -> Result<CachedModel, axum::response::Response> {
+    let cache_key = (project_id.to_string(), commit_id.to_string());
+    if let Some(entry) = state.model_cache.write().await.get(&cache_key) {
+        return Ok(entry);
+    }
+
     let store = state.store.read().await;
-    let project = ProjectId::new(&project_id);
-    let commit = CommitId::new(&commit_id);
+    let project = ProjectId::new(project_id);
+    let commit = CommitId::new(commit_id);
 
     match store.get_snapshot(&project, &commit) {
-        Ok(Some(snapshot)) => {
-            match snapshot.graph() {
-                Ok(graph) => {
-                    let json = to_json_string(&graph);
-                    (
-                        StatusCode::OK,
-                        [("content-type", "application/json")],
-                        json,
-                    )
-                        .into_response()
-                }
-                Err(e) => (
-                    StatusCode::INTERNAL_SERVER_ERROR,
-                    Json(ErrorResponse {
-                        error: e.to_string(),
-                    }),
-                )
-                    .into_response(),
+        Ok(Some(snapshot)) => match snapshot.graph() {
+            Ok(graph) => {
+                let entry = CachedModel {
+                    etag: format!("\"{:016x}\"", content_hash(&graph)),
+                    body: Bytes::from(to_json_string(&graph)),
+                    graph: Arc::new(graph),
+                };
+                state
+                    .model_cache
+                    .write()
+                    .await
+                    .insert(cache_key, entry.clone());
+                Ok(entry)
             }
-        }
-        Ok(None) => (
+            Err(e) => Err((
+                StatusCode::INTERNAL_SERVER_ERROR,
+                Json(ErrorResponse {
+                    error: e.to_string(),
+                }),
+            )
+                .into_response()),
+        },
+        Ok(None) => Err((
             StatusCode::NOT_FOUND,
             Json(ErrorResponse {
                 error: "Snapshot not found".to_string(),
             }),
         )
-            .into_response(),
-        Err(e) => (
+            .into_response()),
+        Err(e) => Err((
             StatusCode::INTERNAL_SERVER_ERROR,
             Json(ErrorResponse {
                 error: e.to_string(),
             }),
         )
-            .into_response(),
+            .into_response()),
+    }
+}
+
+/// Get a model snapshot.
+///
+/// Models are immutable per commit, so materialized responses are served
+/// from an LRU cache: repeat hits cost a byte-slice clone, and polls with
+/// a matching `If-None-Match` cost a 304 with no serialization at all.
+async fn get_model(
+    State(state): State<Arc<AppState>>,
+    Path((project_id, commit_id)): Path<(String, String)>,
+    headers: HeaderMap,
+) -> impl IntoResponse {
+    match materialize_model(&state, &project_id, &commit_id).await {
+        Ok(entry) => cached_model_response(&entry, &headers),
+        Err(response) => response,
     }
 }
 
+/// Query parameters for paginated element/relationship listings.
+#[derive(Debug, Deserialize)]
+pub struct PageParams {
+    /// Filter by kind name as it appears in serialized models
+    /// (e.g. `PartUsage` for elements, `satisfy` for relationships).
+    pub kind: Option<String>,
+    /// Resume after this ID (the `next_cursor` of the previous page).
+    pub cursor: Option<String>,
+    /// Page size; clamped to [`MAX_PAGE_SIZE`].
+    pub limit: Option<usize>,
+}
+
+/// One page of elements.
+#[derive(Debug, Serialize)]
+pub struct ElementsPage {
+    pub elements: Vec<serde_json::Value>,
+    /// Pass back as `cursor` to fetch the next page; None on the last page.
+    pub next_cursor: Option<String>,
+}
+
+/// One page of relationships.
+#[derive(Debug, Serialize)]
+pub struct RelationshipsPage {
+    pub relationships: Vec<serde_json::Value>,
+    /// Pass back as `cursor` to fetch the next page; None on the last page.
+    pub next_cursor: Option<String>,
+}
+
+/// Default page size for element-granular endpoints.
+const DEFAULT_PAGE_SIZE: usize = 100;
+/// Upper bound on requested page sizes.
+const MAX_PAGE_SIZE: usize = 1000;
+
+fn page_limit(params: &PageParams) -> usize {
+    params
+        .limit
+        .unwrap_or(DEFAULT_PAGE_SIZE)
+        .clamp(1, MAX_PAGE_SIZE)
+}
+
+/// Take one cursor page from an ID-ordered record iterator.
+///
+/// Records iterate in ID order (the graph maps are keyed by ID), so the
+/// cursor is simply the last ID of the previous page.
+fn paginate<'a, T: Serialize + 'a>(
+    records: impl Iterator<Item = &'a T>,
+    id_of: impl Fn(&T) -> String,
+    params: &PageParams,
+) -> (Vec<serde_json::Value>, Option<String>) {
+    let limit = page_limit(params);
+    let cursor = params.cursor.as_deref();
+
+    let mut page = Vec::with_capacity(limit.min(64));
+    let mut last_id = None;
+    let mut next_cursor = None;
+    for record in records.skip_while(|r| match cursor {
+        Some(cursor) => id_of(r).as_str() <= cursor,
+        None => false,
+    }) {
+        if page.len() == limit {
+            next_cursor = last_id.take();
+            break;
+        }
+        last_id = Some(id_of(record));
+        page.push(serde_json::to_value(record).unwrap_or_default());
+    }
+    (page, next_cursor)
+}
+
+/// List a commit's elements, optionally filtered by kind, one page at a time.
+async fn list_elements(
+    State(state): State<Arc<AppState>>,
+    Path((project_id, commit_id)): Path<(String, String)>,
+    axum::extract::Query(params): axum::extract::Query<PageParams>,
+) -> impl IntoResponse {
+    let entry = match materialize_model(&state, &project_id, &commit_id).await {
+        Ok(entry) => entry,
+        Err(response) => return response,
+    };
+
+    let kind = match params.kind.as_deref().map(ElementKind::from_str) {
+        Some(None) => {
+            return (
+                StatusCode::BAD_REQUEST,
+                Json(ErrorResponse {
+                    error: format!("Unknown element kind: {}", params.kind.unwrap_or_default()),
+                }),
+            )
+                .into_response();
+        }
+        Some(Some(kind)) => Some(kind),
+        None => None,
+    };
+
+    let (elements, next_cursor) = match &kind {
+        Some(kind) => paginate(
+            entry.graph.elements_by_kind(kind),
+            |e| e.id.as_str(),
+            &params,
+        ),
+        None => paginate(entry.graph.elements.values(), |e| e.id.as_str(), &params),
+    };
+    (
+        StatusCode::OK,
+        Json(ElementsPage {
+            elements,
+            next_cursor,
+        }),
+    )
+        .into_response()
+}
+
+/// List the children of a namespace element, one page at a time.
+async fn list_children(
+    State(state): State<Arc<AppState>>,
+    Path((project_id, commit_id, element_id)): Path<(String, String, String)>,
+    axum::extract::Query(params): axum::extract::Query<PageParams>,
+) -> impl IntoResponse {
+    let entry = match materialize_model(&state, &project_id, &commit_id).await {
+        Ok(entry) => entry,
+        Err(response) => return response,
+    };
+
+    let owner = ElementId::from_string(element_id);
+    if entry.graph.get_element(&owner).is_none() {
+        return (
+            StatusCode::NOT_FOUND,
+            Json(ErrorResponse {
+                error: "Element not found".to_string(),
+            }),
+        )
+            .into_response();
+    }
+
+    // children_of follows insertion order; sort a cheap ID list so the
+    // cursor contract (ID-ordered pages) holds here too.
+    let mut children: Vec<_> = entry.graph.children_of(&owner).collect();
+    children.sort_by_key(|child| child.id.clone());
+    let (elements, next_cursor) = paginate(children.into_iter(), |e| e.id.as_str(), &params);
+    (
+        StatusCode::OK,
+        Json(ElementsPage {
+            elements,
+            next_cursor,
+        }),
+    )
+        .into_response()
+}
+
+/// List a commit's relationships, optionally filtered by kind, one page at a time.
+async fn list_relationships(
+    State(state): State<Arc<AppState>>,
+    Path((project_id, commit_id)): Path<(String, String)>,
+    axum::extract::Query(params): axum::extract::Query<PageParams>,
+) -> impl IntoResponse {
+    let entry = match materialize_model(&state, &project_id, &commit_id).await {
+        Ok(entry) => entry,
+        Err(response) => return response,
+    };
+
+    let kind = match params.kind.as_deref() {
+        Some(name) => {
+            // RelationshipKind has no from_str; round-trip through serde.
+            match serde_json::from_value::<RelationshipKind>(serde_json::Value::String(
+                name.to_string(),
+            )) {
+                Ok(kind) => Some(kind),
+                Err(_) => {
+                    return (
+                        StatusCode::BAD_REQUEST,
+                        Json(ErrorResponse {
+                            error: format!("Unknown relationship kind: {}", name),
+                        }),
+                    )
+                        .into_response();
+                }
+            }
+        }
+        None => None,
+    };
+
+    let (relationships, next_cursor) = match &kind {
+        Some(kind) => paginate(
+            entry.graph.relationships_by_kind(kind),
+            |r| r.id.as_str(),
+            &params,
+        ),
+        None => paginate(
+            entry.graph.relationships.values(),
+            |r| r.id.as_str(),
+            &params,
+        ),
+    };
+    (
+        StatusCode::OK,
+        Json(RelationshipsPage {
+            relationships,
+            next_cursor,
+        }),
+    )
+        .into_response()
+}
+
+/// Stream a commit's elements as newline-delimited JSON.
+///
+/// Elements are serialized one at a time into a chunked response body, so
+/// the server never buffers the full result set; thin clients can consume
+/// the stream incrementally.
+async fn stream_elements(
+    State(state): State<Arc<AppState>>,
+    Path((project_id, commit_id)): Path<(String, String)>,
+    axum::extract::Query(params): axum::extract::Query<PageParams>,
+) -> impl IntoResponse {
+    let entry = match materialize_model(&state, &project_id, &commit_id).await {
+        Ok(entry) => entry,
+        Err(response) => return response,
+    };
+
+    let kind = match params.kind.as_deref().map(ElementKind::from_str) {
+        Some(None) => {
+            return (
+                StatusCode::BAD_REQUEST,
+                Json(ErrorResponse {
+                    error: format!("Unknown element kind: {}", params.kind.unwrap_or_default()),
+                }),
+            )
+                .into_response();
+        }
+        Some(Some(kind)) => Some(kind),
+        None => None,
+    };
+
+    use futures_util::StreamExt;
+
+    // Only the ID list is collected up front; each element is serialized
+    // on demand as the response body is pulled.
+    let ids: Vec<ElementId> = match &kind {
+        Some(kind) => entry
+            .graph
+            .elements_by_kind(kind)
+            .map(|e| e.id.clone())
+            .collect(),
+        None => entry.graph.elements.keys().cloned().collect(),
+    };
+    let graph = Arc::clone(&entry.graph);
+    let body = axum::body::Body::from_stream(futures_util::stream::iter(ids).filter_map(
+        move |id| {
+            let graph = Arc::clone(&graph);
+            async move {
+                let element = graph.get_element(&id)?;
+                let mut line = serde_json::to_vec(element).ok()?;
+                line.push(b'\n');
+                Some(Ok::<_, std::convert::Infallible>(Bytes::from(line)))
+            }
+        },
+    ));
+
+    (
+        StatusCode::OK,
+        [("content-type", "application/x-ndjson")],
+        body,
+    )
+        .into_response()
+}
+
 /// Store a model snapshot.
 async fn store_model(
     State(state): State<Arc<AppState>>,
@@ -241,14 +648,22 @@ async fn store_model(
 
     let mut store = state.store.write().await;
     match store.put_snapshot(&project, meta, &graph) {
-        Ok(()) => (
-            StatusCode::CREATED,
-            Json(StoreModelResponse {
-                commit: commit_id,
-                project: project_id,
-            }),
-        )
-            .into_response(),
+        Ok(()) => {
+            // Drop any stale cached response for this (project, commit).
+            state
+                .model_cache
+                .write()
+                .await
+                .remove(&(project_id.clone(), commit_id.clone()));
+            (
+                StatusCode::CREATED,
+                Json(StoreModelResponse {
+                    commit: commit_id,
+                    project: project_id,
+                }),
+            )
+                .into_response()
+        }
         Err(StoreError::Conflict(msg)) => (
             StatusCode::CONFLICT,
             Json(ErrorResponse { error: msg }),
@@ -274,6 +689,22 @@ pub fn create_router(state: Arc<AppState>) -> Router {
             "/projects/:project_id/commits/:commit_id/model",
             get(get_model).post(store_model),
         )
+        .route(
+            "/projects/:project_id/commits/:commit_id/elements",
+            get(list_elements),
+        )
+        .route(
+            "/projects/:project_id/commits/:commit_id/elements/stream",
+            get(stream_elements),
+        )
+        .route(
+            "/projects/:project_id/commits/:commit_id/elements/:element_id/children",
+            get(list_children),
+        )
+        .route(
+            "/projects/:project_id/commits/:commit_id/relationships",
+            get(list_relationships),
+        )
         .with_state(state)
 }
 
@@ -326,6 +757,268 @@ mod tests {
         assert_eq!(response.status(), StatusCode::OK);
     }
 
+    #[tokio::test]
+    async fn get_model_serves_etag_and_304() {
+        use sysml_core::{Element, ElementKind};
+
+        let mut graph = ModelGraph::new();
+        graph.add_element(Element::new_with_kind(ElementKind::Package).with_name("Cached"));
+
+        let mut store = InMemoryStore::new();
+        store
+            .put_snapshot(
+                &ProjectId::new("test"),
+                SnapshotMeta::new(CommitId::new("v1"), "Initial"),
+                &graph,
+            )
+            .unwrap();
+        let state = Arc::new(AppState::with_store(store));
+
+        let response = create_router(state.clone())
+            .oneshot(
+                Request::builder()
+                    .uri("/projects/test/commits/v1/model")
+                    .body(Body::empty())
+                    .unwrap(),
+            )
+            .await
+            .unwrap();
+        assert_eq!(response.status(), StatusCode::OK);
+        let etag = response
+            .headers()
+            .get("etag")
+            .and_then(|v| v.to_str().ok())
+            .map(|v| v.to_string())
+            .expect("response should carry an ETag");
+        let body = axum::body::to_bytes(response.into_body(), usize::MAX)
+            .await
+            .unwrap();
+        assert_eq!(body, Bytes::from(to_json_string(&graph)));
+
+        // A matching If-None-Match poll is answered with an empty 304.
+        let response = create_router(state.clone())
+            .oneshot(
+                Request::builder()
+                    .uri("/projects/test/commits/v1/model")
+                    .header("if-none-match", &etag)
+                    .body(Body::empty())
+                    .unwrap(),
+            )
+            .await
+            .unwrap();
+        assert_eq!(response.status(), StatusCode::NOT_MODIFIED);
+
+        // A repeat hit is served from the cache with the same bytes.
+        let response = create_router(state.clone())
+            .oneshot(
+                Request::builder()
+                    .uri("/projects/test/commits/v1/model")
+                    .body(Body::empty())
+                    .unwrap(),
+            )
+            .await
+            .unwrap();
+        assert_eq!(response.status(), StatusCode::OK);
+        let cached_body = axum::body::to_bytes(response.into_body(), usize::MAX)
+            .await
+            .unwrap();
+        assert_eq!(cached_body, body);
+
+        // The materialized graph is reusable in-process.
+        let cached = state.cached_graph("test", "v1").await.unwrap();
+        assert_eq!(cached.element_count(), graph.element_count());
+    }
+
+    #[tokio::test]
+    async fn elements_paginate_with_cursor() {
+        use sysml_core::{Element, ElementKind};
+
+        let mut graph = ModelGraph::new();
+        for i in 0..5 {
+            graph.add_element(
+                Element::new_with_kind(ElementKind::PartUsage).with_name(format!("P{}", i)),
+            );
+        }
+        graph.add_element(Element::new_with_kind(ElementKind::Package).with_name("Pkg"));
+
+        let mut store = InMemoryStore::new();
+        store
+            .put_snapshot(
+                &ProjectId::new("test"),
+                SnapshotMeta::new(CommitId::new("v1"), "Initial"),
+                &graph,
+            )
+            .unwrap();
+        let state = Arc::new(AppState::with_store(store));
+
+        let mut fetched = Vec::new();
+        let mut cursor: Option<String> = None;
+        loop {
+            let uri = match &cursor {
+                Some(cursor) => format!(
+                    "/projects/test/commits/v1/elements?kind=PartUsage&limit=2&cursor={}",
+                    cursor
+                ),
+                None => "/projects/test/commits/v1/elements?kind=PartUsage&limit=2".to_string(),
+            };
+            let response = create_router(state.clone())
+                .oneshot(Request::builder().uri(uri).body(Body::empty()).unwrap())
+                .await
+                .unwrap();
+            assert_eq!(response.status(), StatusCode::OK);
+            let body = axum::body::to_bytes(response.into_body(), usize::MAX)
+                .await
+                .unwrap();
+            let page: serde_json::Value = serde_json::from_slice(&body).unwrap();
+            let elements = page["elements"].as_array().unwrap();
+            assert!(elements.len() <= 2);
+            fetched.extend(elements.iter().cloned());
+            match page["next_cursor"].as_str() {
+                Some(next) => cursor = Some(next.to_string()),
+                None => break,
+            }
+        }
+
+        // All five parts, no duplicates, package filtered out.
+        assert_eq!(fetched.len(), 5);
+        let mut ids: Vec<&str> = fetched.iter().filter_map(|e| e["id"].as_str()).collect();
+        ids.dedup();
+        assert_eq!(ids.len(), 5);
+
+        let response = create_router(state.clone())
+            .oneshot(
+                Request::builder()
+                    .uri("/projects/test/commits/v1/elements?kind=NotAKind")
+                    .body(Body::empty())
+                    .unwrap(),
+            )
+            .await
+            .unwrap();
+        assert_eq!(response.status(), StatusCode::BAD_REQUEST);
+    }
+
+    #[tokio::test]
+    async fn children_and_relationships_endpoints() {
+        use sysml_core::{Element, ElementKind, Relationship, RelationshipKind, VisibilityKind};
+
+        let mut graph = ModelGraph::new();
+        let pkg = Element::new_with_kind(ElementKind::Package).with_name("Pkg");
+        let pkg_id = graph.add_element(pkg);
+        let part = Element::new_with_kind(ElementKind::PartUsage).with_name("Part");
+        let part_id = graph.add_owned_element(part, pkg_id.clone(), VisibilityKind::Public);
+        graph.add_relationship(Relationship::new(
+            RelationshipKind::Satisfy,
+            part_id,
+            pkg_id.clone(),
+        ));
+
+        let mut store = InMemoryStore::new();
+        store
+            .put_snapshot(
+                &ProjectId::new("test"),
+                SnapshotMeta::new(CommitId::new("v1"), "Initial"),
+                &graph,
+            )
+            .unwrap();
+        let state = Arc::new(AppState::with_store(store));
+
+        let response = create_router(state.clone())
+            .oneshot(
+                Request::builder()
+                    .uri(format!(
+                        "/projects/test/commits/v1/elements/{}/children",
+                        pkg_id.as_str()
+                    ))
+                    .body(Body::empty())
+                    .unwrap(),
+            )
+            .await
+            .unwrap();
+        assert_eq!(response.status(), StatusCode::OK);
+
+        let response = create_router(state.clone())
+            .oneshot(
+                Request::builder()
+                    .uri("/projects/test/commits/v1/relationships?kind=satisfy")
+                    .body(Body::empty())
+                    .unwrap(),
+            )
+            .await
+            .unwrap();
+        assert_eq!(response.status(), StatusCode::OK);
+        let body = axum::body::to_bytes(response.into_body(), usize::MAX)
+            .await
+            .unwrap();
+        let page: serde_json::Value = serde_json::from_slice(&body).unwrap();
+        assert_eq!(page["relationships"].as_array().unwrap().len(), 1);
+    }
+
+    #[tokio::test]
+    async fn stream_elements_emits_ndjson() {
+        use sysml_core::{Element, ElementKind};
+
+        let mut graph = ModelGraph::new();
+        for i in 0..3 {
+            graph.add_element(
+                Element::new_with_kind(ElementKind::PartUsage).with_name(format!("P{}", i)),
+            );
+        }
+
+        let mut store = InMemoryStore::new();
+        store
+            .put_snapshot(
+                &ProjectId::new("test"),
+                SnapshotMeta::new(CommitId::new("v1"), "Initial"),
+                &graph,
+            )
+            .unwrap();
+        let state = Arc::new(AppState::with_store(store));
+
+        let response = create_router(state)
+            .oneshot(
+                Request::builder()
+                    .uri("/projects/test/commits/v1/elements/stream")
+                    .body(Body::empty())
+                    .unwrap(),
+            )
+            .await
+            .unwrap();
+        assert_eq!(response.status(), StatusCode::OK);
+        assert_eq!(
+            response.headers().get("content-type").unwrap(),
+            "application/x-ndjson"
+        );
+        let body = axum::body::to_bytes(response.into_body(), usize::MAX)
+            .await
+            .unwrap();
+        let lines: Vec<serde_json::Value> = body
+            .split(|b| *b == b'\n')
+            .filter(|line| !line.is_empty())
+            .map(|line| serde_json::from_slice(line).unwrap())
+            .collect();
+        assert_eq!(lines.len(), 3);
+    }
+
+    #[tokio::test]
+    async fn model_cache_evicts_least_recently_used() {
+        let mut cache = ModelCache::new(2);
+        let entry = CachedModel {
+            graph: Arc::new(ModelGraph::new()),
+            body: Bytes::new(),
+            etag: "\"0\"".to_string(),
+        };
+        let key = |commit: &str| ("p".to_string(), commit.to_string());
+
+        cache.insert(key("v1"), entry.clone());
+        cache.insert(key("v2"), entry.clone());
+        cache.get(&key("v1"));
+        cache.insert(key("v3"), entry);
+
+        assert!(cache.get(&key("v1")).is_some());
+        assert!(cache.get(&key("v2")).is_none(), "LRU entry should be evicted");
+        assert!(cache.get(&key("v3")).is_some());
+    }
+
     #[tokio::test]
     async fn get_nonexistent_model() {
         let state = Arc::new(AppState::new());
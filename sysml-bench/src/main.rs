@@ -0,0 +1,449 @@
+//! End-to-end corpus benchmark with baseline regression gating.
+//!
+//! The criterion harnesses in `sysml-core/benches` cover resolution
+//! microbenchmarks on synthetic graphs; nothing measured the full
+//! pipeline, which is how the O(n²) `line_col` regression described in
+//! `benchmarks/PERFORMANCE_NOTES.md` shipped unnoticed. This binary runs
+//! the real path over the reference corpus and times each stage:
+//!
+//! 1. parse — `PestParser::parse` over every corpus file (includes the
+//!    multi-file graph merge),
+//! 2. resolve — `resolve_references` on the merged graph,
+//! 3. validate — structural and relationship-type validation,
+//! 4. serialize — `sysml_canon::to_json_string`.
+//!
+//! Peak RSS is read from `VmHWM` in `/proc/self/status` where available.
+//! Results are written as `KEY=VALUE` lines (the format of the existing
+//! `benchmarks/baselines/with_caches.txt`) and compared against the
+//! committed baseline; any stage slower than baseline by more than the
+//! threshold fails the run.
+//!
+//! ```bash
+//! # Record a baseline (run on a quiet machine, release build):
+//! cargo run -p sysml-bench --release -- --update-baseline
+//!
+//! # Gate against it (exits non-zero on regression):
+//! cargo run -p sysml-bench --release
+//! ```
+//!
+//! The corpus root comes from `SYSML_CORPUS_PATH`, falling back to
+//! `references/sysmlv2` in the repository root, with the same subdirs
+//! the spec tests scan (the standard library and example models).
+
+use std::collections::BTreeMap;
+use std::path::{Path, PathBuf};
+use std::process::ExitCode;
+use std::time::Instant;
+
+use sysml_canon::to_json_string;
+use sysml_core::resolution::resolve_references;
+use sysml_text::{Parser, SysmlFile};
+use sysml_text_pest::PestParser;
+use walkdir::WalkDir;
+
+/// Corpus subdirectories to scan, mirroring `sysml-spec-tests`.
+const CORPUS_SUBDIRS: &[&str] = &[
+    // Standard library
+    "SysML-v2-Pilot-Implementation/org.omg.sysml.xpect.tests/library.systems",
+    // Example models
+    "SysML-v2-Models/models",
+];
+
+/// Relative path of the baseline file within the repository.
+const BASELINE_PATH: &str = "benchmarks/baselines/end_to_end.txt";
+
+/// Default allowed slowdown per stage before the gate fails (25%).
+const DEFAULT_THRESHOLD: f64 = 0.25;
+
+/// Timing jitter floor: differences below this many milliseconds never
+/// count as regressions, whatever the ratio says.
+const JITTER_FLOOR_MS: u64 = 50;
+
+/// Stages whose timings are gated against the baseline.
+const GATED_KEYS: &[&str] = &[
+    "BENCHMARK_PARSE_MS",
+    "BENCHMARK_RESOLVE_MS",
+    "BENCHMARK_VALIDATE_MS",
+    "BENCHMARK_SERIALIZE_MS",
+    "BENCHMARK_TOTAL_MS",
+];
+
+fn main() -> ExitCode {
+    let args: Vec<String> = std::env::args().skip(1).collect();
+    let update_baseline = args.iter().any(|a| a == "--update-baseline");
+    let threshold = arg_value(&args, "--threshold")
+        .and_then(|v| v.parse::<f64>().ok())
+        .unwrap_or(DEFAULT_THRESHOLD);
+    let iterations = arg_value(&args, "--iterations")
+        .and_then(|v| v.parse::<usize>().ok())
+        .unwrap_or(1)
+        .max(1);
+
+    let repo_root = repo_root();
+    let corpus_root = corpus_root(&repo_root);
+    let baseline_path = arg_value(&args, "--baseline")
+        .map(PathBuf::from)
+        .unwrap_or_else(|| repo_root.join(BASELINE_PATH));
+
+    let files = discover_corpus(&corpus_root);
+    if files.is_empty() {
+        eprintln!(
+            "No .sysml files found under {:?}; set SYSML_CORPUS_PATH to the references/sysmlv2 checkout",
+            corpus_root
+        );
+        return ExitCode::FAILURE;
+    }
+    println!(
+        "Corpus: {} files, {} bytes ({:?})",
+        files.len(),
+        files.iter().map(|(_, c)| c.len()).sum::<usize>(),
+        corpus_root
+    );
+
+    // Best-of-N per stage to damp scheduler noise; each iteration runs
+    // the whole pipeline so stages see realistic cache state.
+    let mut best: Option<Measurements> = None;
+    for _ in 0..iterations {
+        let run = run_pipeline(&files);
+        best = Some(match best {
+            None => run,
+            Some(prev) => prev.min(run),
+        });
+    }
+    let measurements = best.unwrap().into_map();
+
+    println!();
+    for (key, value) in &measurements {
+        println!("{}={}", key, value);
+    }
+
+    if update_baseline {
+        let serialized: String = measurements
+            .iter()
+            .map(|(k, v)| format!("{}={}\n", k, v))
+            .collect();
+        if let Some(parent) = baseline_path.parent() {
+            let _ = std::fs::create_dir_all(parent);
+        }
+        if let Err(err) = std::fs::write(&baseline_path, serialized) {
+            eprintln!("Failed to write baseline {:?}: {}", baseline_path, err);
+            return ExitCode::FAILURE;
+        }
+        println!("\nBaseline written to {:?}", baseline_path);
+        return ExitCode::SUCCESS;
+    }
+
+    let baseline = match std::fs::read_to_string(&baseline_path) {
+        Ok(content) => parse_baseline(&content),
+        Err(_) => {
+            println!(
+                "\nNo baseline at {:?}; run with --update-baseline to record one",
+                baseline_path
+            );
+            return ExitCode::SUCCESS;
+        }
+    };
+
+    let regressions = find_regressions(&baseline, &measurements, threshold);
+    if regressions.is_empty() {
+        println!("\nAll gated stages within {:.0}% of baseline", threshold * 100.0);
+        ExitCode::SUCCESS
+    } else {
+        println!();
+        for regression in &regressions {
+            println!("REGRESSION: {}", regression);
+        }
+        ExitCode::FAILURE
+    }
+}
+
+/// Per-stage timings and pipeline statistics for one run.
+struct Measurements {
+    parse_ms: u64,
+    resolve_ms: u64,
+    validate_ms: u64,
+    serialize_ms: u64,
+    peak_rss_kb: u64,
+    files: u64,
+    elements: u64,
+    relationships: u64,
+    resolved: u64,
+    unresolved: u64,
+    structural_errors: u64,
+    json_bytes: u64,
+}
+
+impl Measurements {
+    /// Keep the faster timing per stage; statistics are identical
+    /// between iterations, peak RSS is a high-water mark.
+    fn min(self, other: Measurements) -> Measurements {
+        Measurements {
+            parse_ms: self.parse_ms.min(other.parse_ms),
+            resolve_ms: self.resolve_ms.min(other.resolve_ms),
+            validate_ms: self.validate_ms.min(other.validate_ms),
+            serialize_ms: self.serialize_ms.min(other.serialize_ms),
+            peak_rss_kb: self.peak_rss_kb.max(other.peak_rss_kb),
+            ..other
+        }
+    }
+
+    fn into_map(self) -> BTreeMap<String, u64> {
+        let total = self.parse_ms + self.resolve_ms + self.validate_ms + self.serialize_ms;
+        let mut map = BTreeMap::new();
+        map.insert("BENCHMARK_PARSE_MS".to_string(), self.parse_ms);
+        map.insert("BENCHMARK_RESOLVE_MS".to_string(), self.resolve_ms);
+        map.insert("BENCHMARK_VALIDATE_MS".to_string(), self.validate_ms);
+        map.insert("BENCHMARK_SERIALIZE_MS".to_string(), self.serialize_ms);
+        map.insert("BENCHMARK_TOTAL_MS".to_string(), total);
+        map.insert("BENCHMARK_PEAK_RSS_KB".to_string(), self.peak_rss_kb);
+        map.insert("BENCHMARK_FILES".to_string(), self.files);
+        map.insert("BENCHMARK_ELEMENTS".to_string(), self.elements);
+        map.insert("BENCHMARK_RELATIONSHIPS".to_string(), self.relationships);
+        map.insert("BENCHMARK_RESOLVED".to_string(), self.resolved);
+        map.insert("BENCHMARK_UNRESOLVED".to_string(), self.unresolved);
+        map.insert("BENCHMARK_STRUCTURAL_ERRORS".to_string(), self.structural_errors);
+        map.insert("BENCHMARK_JSON_BYTES".to_string(), self.json_bytes);
+        map
+    }
+}
+
+/// Run parse → resolve → validate → serialize once, timing each stage.
+fn run_pipeline(files: &[(String, String)]) -> Measurements {
+    let sysml_files: Vec<SysmlFile> = files
+        .iter()
+        .map(|(path, content)| SysmlFile::new(path, content))
+        .collect();
+
+    let parser = PestParser::new();
+    let start = Instant::now();
+    let parse_result = parser.parse(&sysml_files);
+    let parse_ms = start.elapsed().as_millis() as u64;
+
+    let mut graph = parse_result.graph;
+    let start = Instant::now();
+    let resolution = resolve_references(&mut graph);
+    let resolve_ms = start.elapsed().as_millis() as u64;
+
+    let start = Instant::now();
+    let mut structural_errors = graph.validate_structure();
+    structural_errors.extend(graph.validate_relationship_types());
+    let validate_ms = start.elapsed().as_millis() as u64;
+
+    let start = Instant::now();
+    let json = to_json_string(&graph);
+    let serialize_ms = start.elapsed().as_millis() as u64;
+
+    Measurements {
+        parse_ms,
+        resolve_ms,
+        validate_ms,
+        serialize_ms,
+        peak_rss_kb: peak_rss_kb().unwrap_or(0),
+        files: files.len() as u64,
+        elements: graph.element_count() as u64,
+        relationships: graph.relationship_count() as u64,
+        resolved: resolution.resolved_count as u64,
+        unresolved: resolution.unresolved_count as u64,
+        structural_errors: structural_errors.len() as u64,
+        json_bytes: json.len() as u64,
+    }
+}
+
+/// Discover corpus files as (relative path, content), sorted for
+/// deterministic ordering.
+fn discover_corpus(corpus_root: &Path) -> Vec<(String, String)> {
+    let mut files = Vec::new();
+    for subdir in CORPUS_SUBDIRS {
+        let dir = corpus_root.join(subdir);
+        if !dir.exists() {
+            continue;
+        }
+        for entry in WalkDir::new(&dir)
+            .follow_links(true)
+            .into_iter()
+            .filter_map(|e| e.ok())
+        {
+            let path = entry.path();
+            if path.is_file() && path.extension().is_some_and(|ext| ext == "sysml") {
+                if let Ok(content) = std::fs::read_to_string(path) {
+                    let relative = path
+                        .strip_prefix(corpus_root)
+                        .unwrap_or(path)
+                        .to_string_lossy()
+                        .to_string();
+                    files.push((relative, content));
+                }
+            }
+        }
+    }
+    files.sort_by(|a, b| a.0.cmp(&b.0));
+    files
+}
+
+/// The repository root (parent of this crate's manifest directory).
+fn repo_root() -> PathBuf {
+    Path::new(env!("CARGO_MANIFEST_DIR"))
+        .parent()
+        .expect("crate lives inside the workspace")
+        .to_path_buf()
+}
+
+/// Corpus root from `SYSML_CORPUS_PATH`, else `references/sysmlv2`.
+fn corpus_root(repo_root: &Path) -> PathBuf {
+    std::env::var("SYSML_CORPUS_PATH")
+        .map(PathBuf::from)
+        .unwrap_or_else(|_| repo_root.join("references/sysmlv2"))
+}
+
+/// The value following a `--flag` argument, if present.
+fn arg_value<'a>(args: &'a [String], flag: &str) -> Option<&'a str> {
+    args.iter()
+        .position(|a| a == flag)
+        .and_then(|i| args.get(i + 1))
+        .map(String::as_str)
+}
+
+/// Parse `KEY=VALUE` baseline lines; unknown lines are ignored.
+fn parse_baseline(content: &str) -> BTreeMap<String, u64> {
+    content
+        .lines()
+        .filter_map(|line| {
+            let (key, value) = line.trim().split_once('=')?;
+            Some((key.to_string(), value.parse().ok()?))
+        })
+        .collect()
+}
+
+/// Compare gated stages against the baseline.
+///
+/// A stage regresses when it is slower than `baseline * (1 + threshold)`
+/// and the difference exceeds the jitter floor. Stages missing from the
+/// baseline are skipped (an older baseline stays usable after new
+/// stages are added).
+fn find_regressions(
+    baseline: &BTreeMap<String, u64>,
+    current: &BTreeMap<String, u64>,
+    threshold: f64,
+) -> Vec<String> {
+    let mut regressions = Vec::new();
+    for key in GATED_KEYS {
+        let (Some(&was), Some(&now)) = (baseline.get(*key), current.get(*key)) else {
+            continue;
+        };
+        let limit = (was as f64 * (1.0 + threshold)) as u64;
+        if now > limit && now - was > JITTER_FLOOR_MS {
+            regressions.push(format!(
+                "{}: {} ms vs baseline {} ms (limit {} ms at +{:.0}%)",
+                key,
+                now,
+                was,
+                limit,
+                threshold * 100.0
+            ));
+        }
+    }
+    regressions
+}
+
+/// Peak resident set size in kB from `/proc/self/status` (Linux).
+fn peak_rss_kb() -> Option<u64> {
+    let status = std::fs::read_to_string("/proc/self/status").ok()?;
+    status
+        .lines()
+        .find(|line| line.starts_with("VmHWM:"))?
+        .split_whitespace()
+        .nth(1)?
+        .parse()
+        .ok()
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn baseline_round_trips() {
+        let content = "BENCHMARK_PARSE_MS=287\nBENCHMARK_RESOLVE_MS=164\n# comment\njunk\n";
+        let baseline = parse_baseline(content);
+        assert_eq!(baseline.get("BENCHMARK_PARSE_MS"), Some(&287));
+        assert_eq!(baseline.get("BENCHMARK_RESOLVE_MS"), Some(&164));
+        assert_eq!(baseline.len(), 2);
+    }
+
+    #[test]
+    fn regressions_respect_threshold_and_jitter_floor() {
+        let baseline: BTreeMap<String, u64> = [
+            ("BENCHMARK_PARSE_MS".to_string(), 1000),
+            ("BENCHMARK_RESOLVE_MS".to_string(), 10),
+        ]
+        .into();
+
+        // 30% slower parse: over a 25% threshold and the jitter floor.
+        let mut current = baseline.clone();
+        current.insert("BENCHMARK_PARSE_MS".to_string(), 1300);
+        let regressions = find_regressions(&baseline, &current, 0.25);
+        assert_eq!(regressions.len(), 1);
+        assert!(regressions[0].contains("BENCHMARK_PARSE_MS"));
+
+        // Within the threshold: fine.
+        current.insert("BENCHMARK_PARSE_MS".to_string(), 1200);
+        assert!(find_regressions(&baseline, &current, 0.25).is_empty());
+
+        // Tiny stage tripled, but below the jitter floor: fine.
+        current.insert("BENCHMARK_PARSE_MS".to_string(), 1000);
+        current.insert("BENCHMARK_RESOLVE_MS".to_string(), 30);
+        assert!(find_regressions(&baseline, &current, 0.25).is_empty());
+    }
+
+    #[test]
+    fn stages_missing_from_baseline_are_skipped() {
+        let baseline: BTreeMap<String, u64> =
+            [("BENCHMARK_PARSE_MS".to_string(), 100)].into();
+        let current: BTreeMap<String, u64> = [
+            ("BENCHMARK_PARSE_MS".to_string(), 100),
+            ("BENCHMARK_VALIDATE_MS".to_string(), 900),
+        ]
+        .into();
+        assert!(find_regressions(&baseline, &current, 0.25).is_empty());
+    }
+
+    #[test]
+    fn measurements_min_keeps_fastest_stage_times() {
+        let a = Measurements {
+            parse_ms: 100,
+            resolve_ms: 80,
+            validate_ms: 5,
+            serialize_ms: 20,
+            peak_rss_kb: 5000,
+            files: 2,
+            elements: 10,
+            relationships: 3,
+            resolved: 1,
+            unresolved: 0,
+            structural_errors: 0,
+            json_bytes: 99,
+        };
+        let mut b = a.min(Measurements {
+            parse_ms: 120,
+            resolve_ms: 60,
+            validate_ms: 5,
+            serialize_ms: 25,
+            peak_rss_kb: 6000,
+            files: 2,
+            elements: 10,
+            relationships: 3,
+            resolved: 1,
+            unresolved: 0,
+            structural_errors: 0,
+            json_bytes: 99,
+        });
+        assert_eq!(b.parse_ms, 100);
+        assert_eq!(b.resolve_ms, 60);
+        assert_eq!(b.peak_rss_kb, 6000);
+
+        b.parse_ms = 7;
+        let map = b.into_map();
+        assert_eq!(map["BENCHMARK_TOTAL_MS"], 7 + 60 + 5 + 20);
+        assert_eq!(map["BENCHMARK_JSON_BYTES"], 99);
+    }
+}
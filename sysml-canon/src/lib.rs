@@ -12,8 +12,13 @@
 //! - Testing
 
 use serde::{Deserialize, Serialize};
+use sysml_core::resolution::ResolutionCacheSnapshot;
 use sysml_core::{Element, ModelGraph, Relationship};
 
+pub mod merkle;
+
+pub use merkle::MerkleHasher;
+
 /// Error type for serialization/deserialization failures.
 #[derive(Debug)]
 pub enum CanonError {
@@ -165,11 +170,167 @@ pub fn from_json_value(value: serde_json::Value) -> Result<ModelGraph, CanonErro
     Ok(ModelGraph::from(canon))
 }
 
+/// Serialize a ModelGraph incrementally to any writer.
+///
+/// Produces byte-for-byte the same canonical JSON as [`to_json_string`]
+/// but never materializes the full text: elements and relationships are
+/// written one record at a time, so HTTP responses and file stores only
+/// hold one record's serialization at any moment.
+///
+/// # Arguments
+///
+/// * `graph` - The model graph to serialize
+/// * `writer` - Destination for the JSON text
+pub fn to_json_writer<W: std::io::Write>(
+    graph: &ModelGraph,
+    mut writer: W,
+) -> Result<(), CanonError> {
+    let io_err = |e: std::io::Error| CanonError::SerializeError(e.to_string());
+    let ser_err = |e: serde_json::Error| CanonError::SerializeError(e.to_string());
+
+    // graph.elements / graph.relationships are BTreeMaps keyed by id, so
+    // plain iteration already yields the canonical (id-sorted) order.
+    writer
+        .write_all(b"{\"version\":\"1.0\",\"elements\":[")
+        .map_err(io_err)?;
+    let mut first = true;
+    for element in graph.elements.values() {
+        if !first {
+            writer.write_all(b",").map_err(io_err)?;
+        }
+        first = false;
+        serde_json::to_writer(&mut writer, element).map_err(ser_err)?;
+    }
+    writer.write_all(b"],\"relationships\":[").map_err(io_err)?;
+    let mut first = true;
+    for relationship in graph.relationships.values() {
+        if !first {
+            writer.write_all(b",").map_err(io_err)?;
+        }
+        first = false;
+        serde_json::to_writer(&mut writer, relationship).map_err(ser_err)?;
+    }
+    writer.write_all(b"]}").map_err(io_err)
+}
+
+/// Seed that streams a JSON array of records into a `GraphBuilder`.
+///
+/// Used by [`from_json_reader`] so records go straight into the bulk-load
+/// path instead of an intermediate `Vec` twice the model's size.
+struct RecordArraySeed<'a, T> {
+    builder: &'a mut sysml_core::GraphBuilder,
+    add: fn(&mut sysml_core::GraphBuilder, T),
+}
+
+impl<'de, 'a, T: serde::Deserialize<'de>> serde::de::DeserializeSeed<'de>
+    for RecordArraySeed<'a, T>
+{
+    type Value = ();
+
+    fn deserialize<D: serde::Deserializer<'de>>(self, deserializer: D) -> Result<(), D::Error> {
+        struct ArrayVisitor<'a, T> {
+            builder: &'a mut sysml_core::GraphBuilder,
+            add: fn(&mut sysml_core::GraphBuilder, T),
+        }
+
+        impl<'de, 'a, T: serde::Deserialize<'de>> serde::de::Visitor<'de> for ArrayVisitor<'a, T> {
+            type Value = ();
+
+            fn expecting(&self, f: &mut std::fmt::Formatter) -> std::fmt::Result {
+                f.write_str("an array of records")
+            }
+
+            fn visit_seq<A: serde::de::SeqAccess<'de>>(self, mut seq: A) -> Result<(), A::Error> {
+                while let Some(record) = seq.next_element::<T>()? {
+                    (self.add)(self.builder, record);
+                }
+                Ok(())
+            }
+        }
+
+        deserializer.deserialize_seq(ArrayVisitor {
+            builder: self.builder,
+            add: self.add,
+        })
+    }
+}
+
+/// Deserialize a ModelGraph by streaming from any reader.
+///
+/// Unlike [`from_json_str`], no intermediate representation of the whole
+/// document is built: each element/relationship is deserialized as it is
+/// encountered and fed directly into the `GraphBuilder` bulk-load path,
+/// which wires the graph indexes in one pass at the end.
+///
+/// # Arguments
+///
+/// * `reader` - Source of the JSON text
+///
+/// # Returns
+///
+/// A ModelGraph on success, or an error on parse failure.
+pub fn from_json_reader<R: std::io::Read>(reader: R) -> Result<ModelGraph, CanonError> {
+    struct GraphVisitor;
+
+    impl<'de> serde::de::Visitor<'de> for GraphVisitor {
+        type Value = ModelGraph;
+
+        fn expecting(&self, f: &mut std::fmt::Formatter) -> std::fmt::Result {
+            f.write_str("a canonical graph object")
+        }
+
+        fn visit_map<A: serde::de::MapAccess<'de>>(
+            self,
+            mut map: A,
+        ) -> Result<ModelGraph, A::Error> {
+            let mut builder = sysml_core::GraphBuilder::new();
+            while let Some(key) = map.next_key::<String>()? {
+                match key.as_str() {
+                    "version" => {
+                        let _version: String = map.next_value()?;
+                    }
+                    "elements" => {
+                        map.next_value_seed(RecordArraySeed::<Element> {
+                            builder: &mut builder,
+                            add: |b, e| {
+                                b.add_element(e);
+                            },
+                        })?;
+                    }
+                    "relationships" => {
+                        map.next_value_seed(RecordArraySeed::<Relationship> {
+                            builder: &mut builder,
+                            add: |b, r| {
+                                b.add_relationship(r);
+                            },
+                        })?;
+                    }
+                    _ => {
+                        let _: serde::de::IgnoredAny = map.next_value()?;
+                    }
+                }
+            }
+            Ok(builder.build())
+        }
+    }
+
+    let mut deserializer = serde_json::Deserializer::from_reader(reader);
+    let graph = serde::de::Deserializer::deserialize_map(&mut deserializer, GraphVisitor)?;
+    deserializer
+        .end()
+        .map_err(|e| CanonError::DeserializeError(e.to_string()))?;
+    Ok(graph)
+}
+
 /// Compute a hash of the canonical JSON representation.
 ///
 /// This can be used for content-addressable storage or change detection.
 /// Uses a simple FNV-1a hash for demonstration; in production, consider
 /// using SHA-256 or similar.
+///
+/// Every call re-serializes the whole graph; for repeated change detection
+/// after small edits, use [`MerkleHasher`], which recomputes only the
+/// edited element's path to the root.
 pub fn content_hash(graph: &ModelGraph) -> u64 {
     let json = to_json_string(graph);
     // FNV-1a hash
@@ -181,10 +342,50 @@ pub fn content_hash(graph: &ModelGraph) -> u64 {
     hash
 }
 
+/// Serialize a resolution cache snapshot to a JSON string.
+///
+/// The snapshot should have been created with the content hash of the graph
+/// it was derived from (see [`content_hash`]), so loaders can validate it
+/// with [`resolution_cache_from_json_str`].
+pub fn resolution_cache_to_json_string(snapshot: &ResolutionCacheSnapshot) -> String {
+    serde_json::to_string(snapshot).expect("ResolutionCacheSnapshot should always be serializable")
+}
+
+/// Deserialize a resolution cache snapshot for a specific graph.
+///
+/// Validates the snapshot against the graph's current [`content_hash`] and
+/// the snapshot layout version; a snapshot from a different graph revision
+/// or library build is rejected rather than silently producing stale
+/// resolution results.
+///
+/// # Arguments
+///
+/// * `json` - The JSON string to parse
+/// * `graph` - The graph the snapshot will be used with
+///
+/// # Returns
+///
+/// The snapshot on success, or an error if parsing fails or the snapshot
+/// does not match the graph.
+pub fn resolution_cache_from_json_str(
+    json: &str,
+    graph: &ModelGraph,
+) -> Result<ResolutionCacheSnapshot, CanonError> {
+    let snapshot: ResolutionCacheSnapshot = serde_json::from_str(json)?;
+    if !snapshot.is_compatible(content_hash(graph)) {
+        return Err(CanonError::DeserializeError(format!(
+            "resolution cache snapshot is stale: version {} / hash {:#x} does not match the graph",
+            snapshot.version, snapshot.content_hash
+        )));
+    }
+    Ok(snapshot)
+}
+
 #[cfg(test)]
 mod tests {
     use super::*;
-    use sysml_core::{Element, ElementKind, Relationship, RelationshipKind};
+    use sysml_core::resolution::ResolutionContext;
+    use sysml_core::{Element, ElementKind, Relationship, RelationshipKind, VisibilityKind};
 
     fn create_test_graph() -> ModelGraph {
         let mut graph = ModelGraph::new();
@@ -279,6 +480,73 @@ mod tests {
         assert!(json.contains('\n'), "Pretty output should have newlines");
     }
 
+    #[test]
+    fn resolution_cache_roundtrip_and_staleness() {
+        let mut graph = ModelGraph::new();
+        let lib = Element::new_with_kind(ElementKind::Package).with_name("Lib");
+        let lib_id = graph.add_element(lib);
+        let part = Element::new_with_kind(ElementKind::PartDefinition).with_name("Base");
+        graph.add_owned_element(part, lib_id.clone(), VisibilityKind::Public);
+        graph.register_library_package(lib_id.clone());
+        graph.ensure_library_index();
+
+        let mut context = ResolutionContext::new(&graph);
+        context.get_full_scope_table(&lib_id);
+        let snapshot = context.snapshot(content_hash(&graph));
+
+        let json = resolution_cache_to_json_string(&snapshot);
+        let restored = resolution_cache_from_json_str(&json, &graph).unwrap();
+        assert_eq!(restored.scope_table_count(), snapshot.scope_table_count());
+
+        // Changing the graph invalidates the snapshot.
+        let elem = Element::new_with_kind(ElementKind::RequirementUsage).with_name("C");
+        graph.add_element(elem);
+        assert!(resolution_cache_from_json_str(&json, &graph).is_err());
+    }
+
+    #[test]
+    fn writer_output_matches_string() {
+        let graph = create_test_graph();
+
+        let mut buf = Vec::new();
+        to_json_writer(&graph, &mut buf).unwrap();
+
+        assert_eq!(
+            String::from_utf8(buf).unwrap(),
+            to_json_string(&graph),
+            "Streaming output must be byte-identical to the string path"
+        );
+    }
+
+    #[test]
+    fn reader_roundtrip() {
+        let graph = create_test_graph();
+        let json = to_json_string(&graph);
+
+        let restored = from_json_reader(json.as_bytes()).unwrap();
+
+        assert_eq!(graph.element_count(), restored.element_count());
+        assert_eq!(graph.relationship_count(), restored.relationship_count());
+        assert_eq!(content_hash(&graph), content_hash(&restored));
+    }
+
+    #[test]
+    fn reader_rejects_malformed_input() {
+        assert!(from_json_reader(&b"{\"elements\":["[..]).is_err());
+        assert!(from_json_reader(&b"[]"[..]).is_err());
+    }
+
+    #[test]
+    fn streaming_roundtrip_empty_graph() {
+        let graph = ModelGraph::new();
+
+        let mut buf = Vec::new();
+        to_json_writer(&graph, &mut buf).unwrap();
+        let restored = from_json_reader(&buf[..]).unwrap();
+
+        assert!(restored.is_empty());
+    }
+
     #[test]
     fn to_and_from_value() {
         let graph = create_test_graph();
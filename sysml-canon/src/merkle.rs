@@ -0,0 +1,437 @@
+//! Merkle-style hierarchical content hashing over the ownership tree.
+//!
+//! [`crate::content_hash`] re-serializes the whole graph on every call,
+//! which makes change detection after a small edit cost a full pass. The
+//! [`MerkleHasher`] in this module keeps a per-element hash plus rolled-up
+//! subtree hashes keyed by the ownership tree, so after an edit only the
+//! edited element's path to the root needs recomputation, and two graphs
+//! can be diffed by descending only into subtrees whose hashes differ.
+
+use std::collections::{BTreeSet, HashMap, HashSet};
+use sysml_core::{ElementId, ModelGraph};
+
+const FNV_OFFSET: u64 = 0xcbf29ce484222325;
+const FNV_PRIME: u64 = 0x100000001b3;
+
+fn fnv1a_fold_bytes(hash: u64, bytes: &[u8]) -> u64 {
+    let mut hash = hash;
+    for byte in bytes {
+        hash ^= *byte as u64;
+        hash = hash.wrapping_mul(FNV_PRIME);
+    }
+    hash
+}
+
+fn fnv1a_fold_u64(hash: u64, value: u64) -> u64 {
+    fnv1a_fold_bytes(hash, &value.to_le_bytes())
+}
+
+/// Incremental content hasher over a graph's ownership tree.
+///
+/// The hasher is a snapshot index in the same spirit as the query-side
+/// indexes: it is built from a graph, answers hash queries cheaply, and is
+/// kept current by calling [`MerkleHasher::update`] with each edited
+/// element (or [`MerkleHasher::remove`] for deletions, followed by an
+/// `update` of the old owner). After bulk edits it is cheaper to rebuild.
+///
+/// An element's own hash covers its serialized content plus its outgoing
+/// relationships; its subtree hash folds the own hash with the subtree
+/// hashes of its owned children in ID order. The [`MerkleHasher::root_hash`]
+/// folds the subtree hashes of all top-level elements, so it changes
+/// whenever any element or relationship changes — the same guarantee as
+/// [`crate::content_hash`], at path-to-root cost per edit.
+///
+/// Ownership is derived from each element's `owner` field (the `owner` may
+/// be set after the element was added, so the graph's child index cannot be
+/// relied on here); the hasher maintains its own parent/child maps and
+/// patches them when `update` observes an ownership change.
+#[derive(Debug, Clone)]
+pub struct MerkleHasher {
+    /// Hash of each element's own content, including outgoing relationships.
+    element_hashes: HashMap<ElementId, u64>,
+    /// Rolled-up hash of each element's ownership subtree.
+    subtree_hashes: HashMap<ElementId, u64>,
+    /// Owner-derived child lists, kept sorted by ID.
+    children: HashMap<ElementId, Vec<ElementId>>,
+    /// Owner of each non-top-level element.
+    parents: HashMap<ElementId, ElementId>,
+    /// Elements with no (present) owner, in ID order for the root fold.
+    top_level: BTreeSet<ElementId>,
+    /// Combined hash over all top-level subtrees.
+    root_hash: u64,
+}
+
+impl MerkleHasher {
+    /// Build the hasher for the current state of a graph.
+    pub fn build(graph: &ModelGraph) -> Self {
+        let mut hasher = MerkleHasher {
+            element_hashes: HashMap::with_capacity(graph.element_count()),
+            subtree_hashes: HashMap::with_capacity(graph.element_count()),
+            children: HashMap::new(),
+            parents: HashMap::new(),
+            top_level: BTreeSet::new(),
+            root_hash: FNV_OFFSET,
+        };
+
+        for (id, element) in graph.elements.iter() {
+            let own = hasher.compute_element_hash(graph, id);
+            hasher.element_hashes.insert(id.clone(), own);
+            match &element.owner {
+                Some(owner) if graph.elements.contains_key(owner) => {
+                    hasher.attach(id.clone(), owner.clone());
+                }
+                _ => {
+                    hasher.top_level.insert(id.clone());
+                }
+            }
+        }
+
+        let top_level: Vec<ElementId> = hasher.top_level.iter().cloned().collect();
+        let mut visited = HashSet::new();
+        for id in &top_level {
+            hasher.compute_subtree_hash(graph, id, &mut visited);
+        }
+
+        hasher.root_hash = hasher.compute_root_hash();
+        hasher
+    }
+
+    /// The combined hash over the whole graph.
+    pub fn root_hash(&self) -> u64 {
+        self.root_hash
+    }
+
+    /// The cached subtree hash for an element, if present.
+    pub fn subtree_hash(&self, id: &ElementId) -> Option<u64> {
+        self.subtree_hashes.get(id).copied()
+    }
+
+    /// The cached own-content hash for an element, if present.
+    pub fn element_hash(&self, id: &ElementId) -> Option<u64> {
+        self.element_hashes.get(id).copied()
+    }
+
+    /// Recompute hashes along an edited element's path to the root.
+    ///
+    /// Call after mutating the element, its outgoing relationships, its
+    /// ownership, or adding it to the graph. Sibling subtrees keep their
+    /// cached hashes; only the edited element and its ancestors (plus the
+    /// former owner's path, if the element was re-parented) are rehashed.
+    pub fn update(&mut self, graph: &ModelGraph, id: &ElementId) {
+        let Some(element) = graph.elements.get(id) else {
+            self.remove(id);
+            self.root_hash = self.compute_root_hash();
+            return;
+        };
+
+        let own = self.compute_element_hash(graph, id);
+        self.element_hashes.insert(id.clone(), own);
+
+        // Patch the parent/child maps if ownership changed.
+        let old_parent = self.parents.get(id).cloned();
+        let new_parent = element
+            .owner
+            .as_ref()
+            .filter(|owner| graph.elements.contains_key(*owner))
+            .cloned();
+        if old_parent != new_parent {
+            self.detach(id);
+            match new_parent.clone() {
+                Some(parent) => self.attach(id.clone(), parent),
+                None => {
+                    self.top_level.insert(id.clone());
+                }
+            }
+        } else if new_parent.is_none() {
+            // First sighting of a new top-level element.
+            self.top_level.insert(id.clone());
+        }
+
+        self.rehash_path(id);
+        if let Some(old) = old_parent.filter(|old| Some(old) != new_parent.as_ref()) {
+            self.rehash_path(&old);
+        }
+        self.root_hash = self.compute_root_hash();
+    }
+
+    /// Drop cached hashes for a removed element.
+    ///
+    /// The caller should follow up with [`MerkleHasher::update`] on the
+    /// removed element's former owner (or any remaining element, to refresh
+    /// ancestor hashes) so the rolled-up hashes reflect the removal.
+    pub fn remove(&mut self, id: &ElementId) {
+        self.element_hashes.remove(id);
+        self.subtree_hashes.remove(id);
+        self.detach(id);
+        self.children.remove(id);
+        self.root_hash = self.compute_root_hash();
+    }
+
+    /// Elements whose content differs from `other`'s snapshot.
+    ///
+    /// Descends the ownership tree and skips any subtree whose rolled-up
+    /// hash matches in both hashers, so the cost is proportional to the
+    /// size of the changed regions rather than the whole graph. Returns
+    /// elements that changed or are present only in this hasher; run the
+    /// diff in the other direction to find deletions.
+    pub fn changed_elements(&self, other: &MerkleHasher) -> Vec<ElementId> {
+        let mut changed = Vec::new();
+        for id in &self.top_level {
+            self.collect_changed(other, id, &mut changed);
+        }
+        changed
+    }
+
+    fn collect_changed(&self, other: &MerkleHasher, id: &ElementId, changed: &mut Vec<ElementId>) {
+        if self.subtree_hashes.get(id) == other.subtree_hashes.get(id) {
+            return;
+        }
+        if self.element_hashes.get(id) != other.element_hashes.get(id) {
+            changed.push(id.clone());
+        }
+        if let Some(child_ids) = self.children.get(id) {
+            for child_id in child_ids {
+                self.collect_changed(other, child_id, changed);
+            }
+        }
+    }
+
+    /// Insert `id` into `parent`'s sorted child list.
+    fn attach(&mut self, id: ElementId, parent: ElementId) {
+        let siblings = self.children.entry(parent.clone()).or_default();
+        if let Err(pos) = siblings.binary_search(&id) {
+            siblings.insert(pos, id.clone());
+        }
+        self.parents.insert(id, parent);
+    }
+
+    /// Remove `id` from its parent's child list or the top-level set.
+    fn detach(&mut self, id: &ElementId) {
+        if let Some(parent) = self.parents.remove(id) {
+            if let Some(siblings) = self.children.get_mut(&parent) {
+                siblings.retain(|sibling| sibling != id);
+            }
+        } else {
+            self.top_level.remove(id);
+        }
+    }
+
+    /// Recompute subtree hashes from `id` up the cached owner chain.
+    fn rehash_path(&mut self, id: &ElementId) {
+        // The seen-set guards against malformed ownership cycles.
+        let mut seen = HashSet::new();
+        let mut current = Some(id.clone());
+        while let Some(cur) = current {
+            if !seen.insert(cur.clone()) {
+                break;
+            }
+            let subtree = self.fold_subtree_from_cache(&cur);
+            self.subtree_hashes.insert(cur.clone(), subtree);
+            current = self.parents.get(&cur).cloned();
+        }
+    }
+
+    /// Hash an element's serialized content and outgoing relationships.
+    fn compute_element_hash(&self, graph: &ModelGraph, id: &ElementId) -> u64 {
+        let mut hash = FNV_OFFSET;
+        if let Some(element) = graph.elements.get(id) {
+            let json =
+                serde_json::to_string(element).expect("Element should always be serializable");
+            hash = fnv1a_fold_bytes(hash, json.as_bytes());
+        }
+
+        let mut outgoing: Vec<_> = graph.outgoing(id).collect();
+        outgoing.sort_by(|a, b| a.id.as_str().cmp(&b.id.as_str()));
+        for relationship in outgoing {
+            let json = serde_json::to_string(relationship)
+                .expect("Relationship should always be serializable");
+            hash = fnv1a_fold_bytes(hash, json.as_bytes());
+        }
+        hash
+    }
+
+    /// Recursively compute and cache subtree hashes (used by `build`).
+    fn compute_subtree_hash(
+        &mut self,
+        graph: &ModelGraph,
+        id: &ElementId,
+        visited: &mut HashSet<ElementId>,
+    ) -> u64 {
+        if !visited.insert(id.clone()) {
+            // Ownership cycle guard: fall back to the own hash.
+            return self.element_hashes.get(id).copied().unwrap_or(FNV_OFFSET);
+        }
+
+        let mut hash = FNV_OFFSET;
+        hash = fnv1a_fold_u64(
+            hash,
+            self.element_hashes.get(id).copied().unwrap_or(FNV_OFFSET),
+        );
+        let child_ids = self.children.get(id).cloned().unwrap_or_default();
+        for child_id in &child_ids {
+            let child_hash = self.compute_subtree_hash(graph, child_id, visited);
+            hash = fnv1a_fold_u64(hash, child_hash);
+        }
+
+        self.subtree_hashes.insert(id.clone(), hash);
+        hash
+    }
+
+    /// Recompute one subtree hash from already-cached child hashes.
+    fn fold_subtree_from_cache(&self, id: &ElementId) -> u64 {
+        let mut hash = FNV_OFFSET;
+        hash = fnv1a_fold_u64(
+            hash,
+            self.element_hashes.get(id).copied().unwrap_or(FNV_OFFSET),
+        );
+        if let Some(child_ids) = self.children.get(id) {
+            for child_id in child_ids {
+                hash = fnv1a_fold_u64(
+                    hash,
+                    self.subtree_hashes
+                        .get(child_id)
+                        .copied()
+                        .unwrap_or(FNV_OFFSET),
+                );
+            }
+        }
+        hash
+    }
+
+    /// Fold the subtree hashes of all top-level elements in ID order.
+    fn compute_root_hash(&self) -> u64 {
+        let mut hash = FNV_OFFSET;
+        for id in &self.top_level {
+            hash = fnv1a_fold_u64(
+                hash,
+                self.subtree_hashes.get(id).copied().unwrap_or(FNV_OFFSET),
+            );
+        }
+        hash
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use sysml_core::{Element, ElementKind, Relationship, RelationshipKind, Value, VisibilityKind};
+
+    fn create_nested_graph() -> (ModelGraph, ElementId, ElementId, ElementId) {
+        let mut graph = ModelGraph::new();
+        let pkg = Element::new_with_kind(ElementKind::Package).with_name("Pkg");
+        let pkg_id = graph.add_element(pkg);
+
+        let part = Element::new_with_kind(ElementKind::PartDefinition).with_name("Part");
+        let part_id = graph.add_owned_element(part, pkg_id.clone(), VisibilityKind::Public);
+
+        let other = Element::new_with_kind(ElementKind::Package).with_name("Other");
+        let other_id = graph.add_element(other);
+
+        (graph, pkg_id, part_id, other_id)
+    }
+
+    #[test]
+    fn root_hash_deterministic_and_content_sensitive() {
+        let (graph, _, part_id, _) = create_nested_graph();
+
+        let hasher1 = MerkleHasher::build(&graph);
+        let hasher2 = MerkleHasher::build(&graph);
+        assert_eq!(hasher1.root_hash(), hasher2.root_hash());
+
+        let mut edited = graph.clone();
+        if let Some(element) = edited.elements.get_mut(&part_id) {
+            element.set_prop("doc", Value::String("changed".to_string()));
+        }
+        let hasher3 = MerkleHasher::build(&edited);
+        assert_ne!(hasher1.root_hash(), hasher3.root_hash());
+    }
+
+    #[test]
+    fn update_matches_full_rebuild() {
+        let (mut graph, pkg_id, part_id, other_id) = create_nested_graph();
+        let mut hasher = MerkleHasher::build(&graph);
+        let untouched_before = hasher.subtree_hash(&other_id);
+
+        if let Some(element) = graph.elements.get_mut(&part_id) {
+            element.set_prop("doc", Value::String("changed".to_string()));
+        }
+        hasher.update(&graph, &part_id);
+
+        let rebuilt = MerkleHasher::build(&graph);
+        assert_eq!(hasher.root_hash(), rebuilt.root_hash());
+        assert_eq!(hasher.subtree_hash(&pkg_id), rebuilt.subtree_hash(&pkg_id));
+
+        // Sibling subtrees keep their cached hashes.
+        assert_eq!(hasher.subtree_hash(&other_id), untouched_before);
+    }
+
+    #[test]
+    fn outgoing_relationship_changes_owner_path() {
+        let (mut graph, pkg_id, part_id, other_id) = create_nested_graph();
+        let mut hasher = MerkleHasher::build(&graph);
+
+        let rel = Relationship::new(RelationshipKind::Trace, part_id.clone(), other_id);
+        graph.add_relationship(rel);
+        hasher.update(&graph, &part_id);
+
+        let rebuilt = MerkleHasher::build(&graph);
+        assert_eq!(hasher.root_hash(), rebuilt.root_hash());
+        assert_eq!(hasher.subtree_hash(&pkg_id), rebuilt.subtree_hash(&pkg_id));
+    }
+
+    #[test]
+    fn update_handles_added_and_removed_elements() {
+        let (mut graph, pkg_id, _, _) = create_nested_graph();
+        let mut hasher = MerkleHasher::build(&graph);
+
+        // add_owned_element introduces the element plus its membership.
+        let added = Element::new_with_kind(ElementKind::PartUsage).with_name("New");
+        let added_id = graph.add_owned_element(added, pkg_id.clone(), VisibilityKind::Public);
+        let membership_id = graph
+            .get_element(&added_id)
+            .and_then(|e| e.owning_membership.clone())
+            .unwrap();
+        hasher.update(&graph, &added_id);
+        hasher.update(&graph, &membership_id);
+        assert_eq!(hasher.root_hash(), MerkleHasher::build(&graph).root_hash());
+
+        graph.remove_element(&added_id);
+        graph.remove_element(&membership_id);
+        hasher.remove(&added_id);
+        hasher.remove(&membership_id);
+        hasher.update(&graph, &pkg_id);
+        assert_eq!(hasher.root_hash(), MerkleHasher::build(&graph).root_hash());
+    }
+
+    #[test]
+    fn changed_elements_finds_only_edited_subtree() {
+        let (graph, _, part_id, _) = create_nested_graph();
+        let before = MerkleHasher::build(&graph);
+
+        let mut edited = graph.clone();
+        if let Some(element) = edited.elements.get_mut(&part_id) {
+            element.set_prop("doc", Value::String("changed".to_string()));
+        }
+        let after = MerkleHasher::build(&edited);
+
+        let changed = after.changed_elements(&before);
+        assert_eq!(changed, vec![part_id]);
+
+        let unchanged = before.changed_elements(&before);
+        assert!(unchanged.is_empty());
+    }
+
+    #[test]
+    fn changed_elements_reports_additions() {
+        let (graph, pkg_id, _, _) = create_nested_graph();
+        let before = MerkleHasher::build(&graph);
+
+        let mut edited = graph.clone();
+        let added = Element::new_with_kind(ElementKind::PartUsage).with_name("New");
+        let added_id = edited.add_owned_element(added, pkg_id, VisibilityKind::Public);
+        let after = MerkleHasher::build(&edited);
+
+        let changed = after.changed_elements(&before);
+        assert!(changed.contains(&added_id));
+    }
+}
@@ -0,0 +1,474 @@
+//! Arena-backed, index-addressed element storage.
+//!
+//! `ModelGraph` stores elements and relationships in `BTreeMap`s keyed by
+//! `ElementId`. That representation is convenient for editing, but traversal
+//! of large merged models (millions of elements) is dominated by cache misses
+//! while chasing B-tree nodes keyed by UUID-sized IDs.
+//!
+//! This module provides [`ArenaGraph`], an immutable storage mode where:
+//!
+//! - Elements and relationships live in contiguous arenas (`Vec`s), addressed
+//!   by dense `u32` handles ([`ElementHandle`], [`RelationshipHandle`]).
+//! - Each `ElementId` is mapped to its handle exactly once, at build time.
+//! - The structural indexes (`owner -> children`, `source -> relationships`,
+//!   `target -> relationships`, `kind -> elements`) are stored in CSR form:
+//!   one sorted, contiguous vector of handles per index, sliced by per-key
+//!   ranges. Iterating children or outgoing relationships is a plain array
+//!   walk with no hashing or pointer chasing.
+//!
+//! Build an `ArenaGraph` with [`ArenaGraph::from_graph`] (or
+//! [`ModelGraph::to_arena`]) after loading/merging is complete, then run
+//! traversal-heavy passes (resolution, validation, queries) against it.
+//! The graph is a snapshot: mutations go through `ModelGraph` and a new
+//! arena is built when needed.
+
+use rustc_hash::FxHashMap;
+
+use sysml_id::ElementId;
+
+use crate::{Element, ElementKind, ModelGraph, Relationship, RelationshipKind};
+
+/// A dense handle addressing an element in an [`ArenaGraph`].
+///
+/// Handles are assigned contiguously from 0 at build time, in the stable
+/// (sorted-by-id) order of the source `ModelGraph`, so they are deterministic
+/// for a given model and can be used as array indexes.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, PartialOrd, Ord, Hash)]
+pub struct ElementHandle(pub u32);
+
+impl ElementHandle {
+    /// The handle as an array index.
+    #[inline]
+    pub fn index(self) -> usize {
+        self.0 as usize
+    }
+}
+
+/// A dense handle addressing a relationship in an [`ArenaGraph`].
+#[derive(Debug, Clone, Copy, PartialEq, Eq, PartialOrd, Ord, Hash)]
+pub struct RelationshipHandle(pub u32);
+
+impl RelationshipHandle {
+    /// The handle as an array index.
+    #[inline]
+    pub fn index(self) -> usize {
+        self.0 as usize
+    }
+}
+
+/// A compressed-sparse-row index: for each key handle, a contiguous range of
+/// target handles in a single shared vector.
+///
+/// `offsets` has one entry per key plus a trailing sentinel; the targets for
+/// key `k` are `targets[offsets[k]..offsets[k + 1]]`.
+#[derive(Debug, Clone, Default)]
+struct CsrIndex {
+    offsets: Vec<u32>,
+    targets: Vec<u32>,
+}
+
+impl CsrIndex {
+    /// Build a CSR index over `key_count` keys from (key, target) pairs.
+    fn build(key_count: usize, pairs: &[(u32, u32)]) -> Self {
+        let mut counts = vec![0u32; key_count + 1];
+        for &(key, _) in pairs {
+            counts[key as usize + 1] += 1;
+        }
+        // Prefix-sum the counts into offsets.
+        for i in 1..counts.len() {
+            counts[i] += counts[i - 1];
+        }
+        let offsets = counts;
+        let mut cursor = offsets.clone();
+        let mut targets = vec![0u32; pairs.len()];
+        for &(key, target) in pairs {
+            let slot = cursor[key as usize];
+            targets[slot as usize] = target;
+            cursor[key as usize] += 1;
+        }
+        // Keep each range sorted so iteration order is deterministic.
+        for k in 0..key_count {
+            let range = offsets[k] as usize..offsets[k + 1] as usize;
+            targets[range].sort_unstable();
+        }
+        CsrIndex { offsets, targets }
+    }
+
+    /// The target handles for the given key.
+    #[inline]
+    fn get(&self, key: u32) -> &[u32] {
+        let start = self.offsets[key as usize] as usize;
+        let end = self.offsets[key as usize + 1] as usize;
+        &self.targets[start..end]
+    }
+}
+
+/// An immutable, arena-backed snapshot of a [`ModelGraph`].
+///
+/// All elements and relationships are stored contiguously and addressed by
+/// dense `u32` handles; structural indexes are handle ranges over sorted
+/// vectors, so traversals are cache-friendly array walks.
+///
+/// # Examples
+///
+/// ```
+/// use sysml_core::{ArenaGraph, Element, ElementKind, ModelGraph};
+///
+/// let mut graph = ModelGraph::new();
+/// let pkg = graph.add_element(Element::new_with_kind(ElementKind::Package).with_name("P"));
+/// graph.add_element(
+///     Element::new_with_kind(ElementKind::PartUsage)
+///         .with_name("part")
+///         .with_owner(pkg.clone()),
+/// );
+///
+/// let arena = graph.to_arena();
+/// let pkg_handle = arena.handle_of(&pkg).unwrap();
+/// assert_eq!(arena.children_of(pkg_handle).count(), 1);
+/// ```
+#[derive(Debug, Clone, Default)]
+pub struct ArenaGraph {
+    /// Element arena; `ElementHandle(i)` addresses `elements[i]`.
+    elements: Vec<Element>,
+    /// Relationship arena; `RelationshipHandle(i)` addresses `relationships[i]`.
+    relationships: Vec<Relationship>,
+    /// ElementId -> handle, built once from the source graph.
+    id_to_handle: FxHashMap<ElementId, ElementHandle>,
+    /// Relationship ElementId -> handle.
+    rel_id_to_handle: FxHashMap<ElementId, RelationshipHandle>,
+
+    /// owner handle -> child element handles (CSR).
+    children: CsrIndex,
+    /// source element handle -> relationship handles (CSR).
+    outgoing: CsrIndex,
+    /// target element handle -> relationship handles (CSR).
+    incoming: CsrIndex,
+
+    /// Element handles sorted by kind; `kind_ranges` slices into this.
+    by_kind: Vec<u32>,
+    /// kind -> range in `by_kind`.
+    kind_ranges: FxHashMap<ElementKind, (u32, u32)>,
+    /// Handles of root elements (no owner), sorted.
+    roots: Vec<u32>,
+}
+
+impl ArenaGraph {
+    /// Build an arena snapshot from a `ModelGraph`.
+    ///
+    /// Elements and relationships are cloned into contiguous arenas in the
+    /// graph's stable id order, and all structural indexes are built as
+    /// sorted handle ranges. This is an O(n log n) one-time cost intended to
+    /// be paid once per load/merge, after which traversals are array walks.
+    pub fn from_graph(graph: &ModelGraph) -> Self {
+        let element_count = graph.elements.len();
+        let rel_count = graph.relationships.len();
+
+        // Assign dense handles in BTreeMap (sorted-by-id) order.
+        let mut elements = Vec::with_capacity(element_count);
+        let mut id_to_handle =
+            FxHashMap::with_capacity_and_hasher(element_count, Default::default());
+        for (id, element) in &graph.elements {
+            let handle = ElementHandle(elements.len() as u32);
+            id_to_handle.insert(id.clone(), handle);
+            elements.push(element.clone());
+        }
+
+        let mut relationships = Vec::with_capacity(rel_count);
+        let mut rel_id_to_handle =
+            FxHashMap::with_capacity_and_hasher(rel_count, Default::default());
+        for (id, rel) in &graph.relationships {
+            let handle = RelationshipHandle(relationships.len() as u32);
+            rel_id_to_handle.insert(id.clone(), handle);
+            relationships.push(rel.clone());
+        }
+
+        // Ownership: (owner handle, child handle) pairs. Owners that are not
+        // in the graph (dangling references) are skipped, matching the
+        // behavior of ModelGraph::children_of on missing entries.
+        let mut owner_pairs = Vec::new();
+        let mut roots = Vec::new();
+        for (handle, element) in elements.iter().enumerate() {
+            match element.owner.as_ref().and_then(|o| id_to_handle.get(o)) {
+                Some(owner) => owner_pairs.push((owner.0, handle as u32)),
+                None => roots.push(handle as u32),
+            }
+        }
+        let children = CsrIndex::build(element_count, &owner_pairs);
+
+        // Relationship endpoints: endpoints not present in the graph are
+        // skipped for the same reason.
+        let mut source_pairs = Vec::with_capacity(rel_count);
+        let mut target_pairs = Vec::with_capacity(rel_count);
+        for (handle, rel) in relationships.iter().enumerate() {
+            if let Some(source) = id_to_handle.get(&rel.source) {
+                source_pairs.push((source.0, handle as u32));
+            }
+            if let Some(target) = id_to_handle.get(&rel.target) {
+                target_pairs.push((target.0, handle as u32));
+            }
+        }
+        let outgoing = CsrIndex::build(element_count, &source_pairs);
+        let incoming = CsrIndex::build(element_count, &target_pairs);
+
+        // Kind buckets: handles sorted by kind, sliced by per-kind ranges.
+        let mut by_kind: Vec<u32> = (0..element_count as u32).collect();
+        by_kind.sort_by(|&a, &b| {
+            let (ea, eb) = (&elements[a as usize], &elements[b as usize]);
+            ea.kind
+                .as_str()
+                .cmp(eb.kind.as_str())
+                .then(a.cmp(&b))
+        });
+        let mut kind_ranges = FxHashMap::default();
+        let mut start = 0usize;
+        while start < by_kind.len() {
+            let kind = elements[by_kind[start] as usize].kind.clone();
+            let mut end = start + 1;
+            while end < by_kind.len() && elements[by_kind[end] as usize].kind == kind {
+                end += 1;
+            }
+            kind_ranges.insert(kind, (start as u32, end as u32));
+            start = end;
+        }
+
+        ArenaGraph {
+            elements,
+            relationships,
+            id_to_handle,
+            rel_id_to_handle,
+            children,
+            outgoing,
+            incoming,
+            by_kind,
+            kind_ranges,
+            roots,
+        }
+    }
+
+    /// Look up the handle for an `ElementId`.
+    #[inline]
+    pub fn handle_of(&self, id: &ElementId) -> Option<ElementHandle> {
+        self.id_to_handle.get(id).copied()
+    }
+
+    /// Look up the handle for a relationship `ElementId`.
+    #[inline]
+    pub fn relationship_handle_of(&self, id: &ElementId) -> Option<RelationshipHandle> {
+        self.rel_id_to_handle.get(id).copied()
+    }
+
+    /// Get an element by handle.
+    #[inline]
+    pub fn element(&self, handle: ElementHandle) -> &Element {
+        &self.elements[handle.index()]
+    }
+
+    /// Get a relationship by handle.
+    #[inline]
+    pub fn relationship(&self, handle: RelationshipHandle) -> &Relationship {
+        &self.relationships[handle.index()]
+    }
+
+    /// Get an element by id (handle lookup plus array index).
+    pub fn get_element(&self, id: &ElementId) -> Option<&Element> {
+        self.handle_of(id).map(|h| self.element(h))
+    }
+
+    /// Get a relationship by id.
+    pub fn get_relationship(&self, id: &ElementId) -> Option<&Relationship> {
+        self.relationship_handle_of(id).map(|h| self.relationship(h))
+    }
+
+    /// The handles of the children of `owner`, as a contiguous sorted slice.
+    #[inline]
+    pub fn child_handles(&self, owner: ElementHandle) -> &[u32] {
+        self.children.get(owner.0)
+    }
+
+    /// Iterate the children of `owner`.
+    pub fn children_of(&self, owner: ElementHandle) -> impl Iterator<Item = &Element> {
+        self.children
+            .get(owner.0)
+            .iter()
+            .map(move |&h| &self.elements[h as usize])
+    }
+
+    /// Iterate relationships whose source is `source`.
+    pub fn outgoing(&self, source: ElementHandle) -> impl Iterator<Item = &Relationship> {
+        self.outgoing
+            .get(source.0)
+            .iter()
+            .map(move |&h| &self.relationships[h as usize])
+    }
+
+    /// Iterate relationships whose target is `target`.
+    pub fn incoming(&self, target: ElementHandle) -> impl Iterator<Item = &Relationship> {
+        self.incoming
+            .get(target.0)
+            .iter()
+            .map(move |&h| &self.relationships[h as usize])
+    }
+
+    /// Iterate all elements of the given kind (exact kind match, like
+    /// `ModelGraph::elements_by_kind`).
+    pub fn elements_by_kind<'a>(
+        &'a self,
+        kind: &ElementKind,
+    ) -> impl Iterator<Item = &'a Element> {
+        let (start, end) = self
+            .kind_ranges
+            .get(kind)
+            .copied()
+            .unwrap_or((0, 0));
+        self.by_kind[start as usize..end as usize]
+            .iter()
+            .map(move |&h| &self.elements[h as usize])
+    }
+
+    /// Iterate relationships of the given kind.
+    pub fn relationships_by_kind<'a>(
+        &'a self,
+        kind: &'a RelationshipKind,
+    ) -> impl Iterator<Item = &'a Relationship> {
+        self.relationships.iter().filter(move |r| &r.kind == kind)
+    }
+
+    /// Iterate all root elements (elements without a resolvable owner).
+    pub fn roots(&self) -> impl Iterator<Item = &Element> {
+        self.roots.iter().map(move |&h| &self.elements[h as usize])
+    }
+
+    /// Iterate all elements in handle order.
+    pub fn elements(&self) -> impl Iterator<Item = &Element> {
+        self.elements.iter()
+    }
+
+    /// Iterate all relationships in handle order.
+    pub fn relationships(&self) -> impl Iterator<Item = &Relationship> {
+        self.relationships.iter()
+    }
+
+    /// The number of elements.
+    pub fn element_count(&self) -> usize {
+        self.elements.len()
+    }
+
+    /// The number of relationships.
+    pub fn relationship_count(&self) -> usize {
+        self.relationships.len()
+    }
+
+    /// Check if the graph is empty.
+    pub fn is_empty(&self) -> bool {
+        self.elements.is_empty() && self.relationships.is_empty()
+    }
+}
+
+impl ModelGraph {
+    /// Build an immutable, arena-backed snapshot of this graph for
+    /// traversal-heavy workloads. See [`ArenaGraph`].
+    pub fn to_arena(&self) -> ArenaGraph {
+        ArenaGraph::from_graph(self)
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn build_graph() -> (ModelGraph, ElementId, ElementId, ElementId) {
+        let mut graph = ModelGraph::new();
+        let pkg = Element::new_with_kind(ElementKind::Package).with_name("Pkg");
+        let pkg_id = graph.add_element(pkg);
+
+        let part = Element::new_with_kind(ElementKind::PartUsage)
+            .with_name("part")
+            .with_owner(pkg_id.clone());
+        let part_id = graph.add_element(part);
+
+        let req = Element::new_with_kind(ElementKind::RequirementUsage)
+            .with_name("req")
+            .with_owner(pkg_id.clone());
+        let req_id = graph.add_element(req);
+
+        graph.add_relationship(Relationship::new(
+            RelationshipKind::Satisfy,
+            part_id.clone(),
+            req_id.clone(),
+        ));
+
+        (graph, pkg_id, part_id, req_id)
+    }
+
+    #[test]
+    fn arena_round_trips_elements() {
+        let (graph, pkg_id, part_id, _) = build_graph();
+        let arena = graph.to_arena();
+
+        assert_eq!(arena.element_count(), 3);
+        assert_eq!(arena.relationship_count(), 1);
+
+        let handle = arena.handle_of(&pkg_id).unwrap();
+        assert_eq!(arena.element(handle).name.as_deref(), Some("Pkg"));
+        assert_eq!(arena.get_element(&part_id).unwrap().kind, ElementKind::PartUsage);
+    }
+
+    #[test]
+    fn arena_children_match_graph() {
+        let (graph, pkg_id, _, _) = build_graph();
+        let arena = graph.to_arena();
+
+        let pkg = arena.handle_of(&pkg_id).unwrap();
+        let mut arena_children: Vec<_> = arena
+            .children_of(pkg)
+            .map(|e| e.id.clone())
+            .collect();
+        let mut graph_children: Vec<_> =
+            graph.children_of(&pkg_id).map(|e| e.id.clone()).collect();
+        arena_children.sort();
+        graph_children.sort();
+        assert_eq!(arena_children, graph_children);
+    }
+
+    #[test]
+    fn arena_outgoing_and_incoming() {
+        let (graph, _, part_id, req_id) = build_graph();
+        let arena = graph.to_arena();
+
+        let part = arena.handle_of(&part_id).unwrap();
+        let req = arena.handle_of(&req_id).unwrap();
+
+        let out: Vec<_> = arena.outgoing(part).collect();
+        assert_eq!(out.len(), 1);
+        assert!(matches!(out[0].kind, RelationshipKind::Satisfy));
+        assert_eq!(out[0].target, req_id);
+
+        let inc: Vec<_> = arena.incoming(req).collect();
+        assert_eq!(inc.len(), 1);
+        assert_eq!(inc[0].source, part_id);
+    }
+
+    #[test]
+    fn arena_kind_index_and_roots() {
+        let (graph, pkg_id, _, _) = build_graph();
+        let arena = graph.to_arena();
+
+        let packages: Vec<_> = arena.elements_by_kind(&ElementKind::Package).collect();
+        assert_eq!(packages.len(), 1);
+        assert_eq!(packages[0].id, pkg_id);
+
+        // No ActionUsage elements: empty range, not a panic.
+        assert_eq!(arena.elements_by_kind(&ElementKind::ActionUsage).count(), 0);
+
+        let roots: Vec<_> = arena.roots().collect();
+        assert_eq!(roots.len(), 1);
+        assert_eq!(roots[0].id, pkg_id);
+    }
+
+    #[test]
+    fn arena_of_empty_graph() {
+        let arena = ModelGraph::new().to_arena();
+        assert!(arena.is_empty());
+        assert_eq!(arena.roots().count(), 0);
+    }
+}
@@ -0,0 +1,378 @@
+//! Bulk ingestion of elements and relationships.
+//!
+//! `ModelGraph::add_element` and `add_relationship` patch every index map on
+//! each call, which is the right trade-off for interactive edits but wasteful
+//! when rebuilding a graph from a parsed corpus: loading the ~36k-element
+//! standard library touches the index maps tens of thousands of times and
+//! re-hashes the same owner keys over and over.
+//!
+//! This module provides a bulk path:
+//!
+//! - [`GraphBuilder`] accumulates elements and relationships in plain
+//!   vectors (no index work at all) and builds the graph in one shot.
+//! - [`ModelGraph::extend_from_iter`] ingests iterators of elements and
+//!   relationships into an existing graph, deferring all index wiring
+//!   (including the membership indexes) until the end and building each
+//!   index in a single sort-then-group pass over pre-counted pairs.
+//!
+//! Both paths produce exactly the same indexes as repeated `add_element` /
+//! `add_relationship` calls.
+
+use sysml_id::{ElementId, IdMap, IdSet};
+
+use crate::membership::props as membership_props;
+use crate::{Element, ElementKind, ModelGraph, Relationship};
+
+impl ModelGraph {
+    /// Bulk-ingest elements and relationships, wiring all indexes at the end.
+    ///
+    /// Elements and relationships are first moved into the graph without any
+    /// index maintenance. Index pairs (owner/child, membership wiring,
+    /// relationship endpoints, typing/specialization reverse entries) are
+    /// collected during that single pass, then each index is built by
+    /// sorting the pairs and inserting grouped entries into maps pre-sized
+    /// from the pair counts. This is O(n log n) overall but touches each map
+    /// once per distinct key instead of once per element.
+    ///
+    /// # Examples
+    ///
+    /// ```
+    /// use sysml_core::{Element, ElementKind, ModelGraph};
+    ///
+    /// let pkg = Element::new_with_kind(ElementKind::Package).with_name("P");
+    /// let pkg_id = pkg.id.clone();
+    /// let part = Element::new_with_kind(ElementKind::PartUsage)
+    ///     .with_owner(pkg_id.clone());
+    ///
+    /// let mut graph = ModelGraph::new();
+    /// graph.extend_from_iter([pkg, part], []);
+    /// assert_eq!(graph.children_of(&pkg_id).count(), 1);
+    /// ```
+    pub fn extend_from_iter<E, R>(&mut self, elements: E, relationships: R)
+    where
+        E: IntoIterator<Item = Element>,
+        R: IntoIterator<Item = Relationship>,
+    {
+        let elements = elements.into_iter();
+        let (low, _) = elements.size_hint();
+
+        // Deferred index pairs, collected in one pass over the input.
+        let mut owner_pairs: Vec<(ElementId, ElementId)> = Vec::with_capacity(low);
+        let mut owning_membership_pairs: Vec<(ElementId, ElementId)> = Vec::new();
+        let mut namespace_pairs: Vec<(ElementId, ElementId)> = Vec::new();
+        let mut typing_pairs: Vec<(ElementId, ElementId)> = Vec::new();
+        let mut specialization_pairs: Vec<(ElementId, ElementId)> = Vec::new();
+
+        for element in elements {
+            let id = element.id.clone();
+
+            if let Some(owner) = &element.owner {
+                owner_pairs.push((owner.clone(), id.clone()));
+            }
+            if let Some(membership_id) = &element.owning_membership {
+                owning_membership_pairs.push((id.clone(), membership_id.clone()));
+            }
+            if element.kind == ElementKind::Membership
+                || element.kind.is_subtype_of(ElementKind::Membership)
+            {
+                if let Some(ns_id) = element
+                    .props
+                    .get(membership_props::MEMBERSHIP_OWNING_NAMESPACE)
+                    .and_then(|v| v.as_ref())
+                {
+                    namespace_pairs.push((ns_id.clone(), id.clone()));
+                }
+            }
+            if element.kind == ElementKind::FeatureTyping
+                || element.kind.is_subtype_of(ElementKind::FeatureTyping)
+            {
+                if let Some(tf_id) = element.props.get("typedFeature").and_then(|v| v.as_ref()) {
+                    typing_pairs.push((tf_id.clone(), id.clone()));
+                }
+            }
+            if element.kind == ElementKind::Specialization
+                || element.kind.is_subtype_of(ElementKind::Specialization)
+            {
+                if let Some(specific_id) =
+                    element.props.get("specific").and_then(|v| v.as_ref())
+                {
+                    specialization_pairs.push((specific_id.clone(), id.clone()));
+                }
+            }
+
+            self.elements.insert(id, element);
+        }
+
+        let mut source_pairs: Vec<(ElementId, ElementId)> = Vec::new();
+        let mut target_pairs: Vec<(ElementId, ElementId)> = Vec::new();
+        for relationship in relationships {
+            let id = relationship.id.clone();
+            source_pairs.push((relationship.source.clone(), id.clone()));
+            target_pairs.push((relationship.target.clone(), id.clone()));
+            self.relationships.insert(id, relationship);
+        }
+
+        // Wire the indexes in grouped passes.
+        extend_set_index(&mut self.owner_to_children, owner_pairs);
+        extend_set_index(&mut self.namespace_to_memberships, namespace_pairs);
+        extend_set_index(&mut self.source_to_rels, source_pairs);
+        extend_set_index(&mut self.target_to_rels, target_pairs);
+        extend_vec_index(&mut self.typed_feature_to_typings, typing_pairs);
+        extend_vec_index(&mut self.specific_to_specializations, specialization_pairs);
+
+        self.element_to_owning_membership
+            .reserve(owning_membership_pairs.len());
+        for (element_id, membership_id) in owning_membership_pairs {
+            self.element_to_owning_membership
+                .insert(element_id, membership_id);
+        }
+    }
+}
+
+/// Sort (key, value) pairs and extend a set-valued index, touching each key
+/// once per group and pre-sizing from the pair count.
+fn extend_set_index(
+    index: &mut IdMap<IdSet>,
+    mut pairs: Vec<(ElementId, ElementId)>,
+) {
+    pairs.sort_unstable();
+    index.reserve(pairs.len());
+    let mut pairs = pairs.into_iter().peekable();
+    while let Some((key, value)) = pairs.next() {
+        let set = index.entry(key.clone()).or_default();
+        set.insert(value);
+        while let Some((next_key, _)) = pairs.peek() {
+            if *next_key != key {
+                break;
+            }
+            let (_, value) = pairs.next().unwrap();
+            set.insert(value);
+        }
+    }
+}
+
+/// Sort (key, value) pairs and extend a vec-valued index.
+fn extend_vec_index(
+    index: &mut IdMap<Vec<ElementId>>,
+    mut pairs: Vec<(ElementId, ElementId)>,
+) {
+    pairs.sort_unstable();
+    index.reserve(pairs.len());
+    let mut pairs = pairs.into_iter().peekable();
+    while let Some((key, value)) = pairs.next() {
+        let list = index.entry(key.clone()).or_default();
+        list.push(value);
+        while let Some((next_key, _)) = pairs.peek() {
+            if *next_key != key {
+                break;
+            }
+            let (_, value) = pairs.next().unwrap();
+            list.push(value);
+        }
+    }
+}
+
+/// A bulk builder for [`ModelGraph`].
+///
+/// Accumulates elements and relationships in plain vectors — no index maps
+/// are touched per insert — and wires every index once in [`build`].
+/// Use this when constructing a graph from a parsed corpus where the
+/// element count is roughly known up front.
+///
+/// # Examples
+///
+/// ```
+/// use sysml_core::{Element, ElementKind, GraphBuilder};
+///
+/// let mut builder = GraphBuilder::with_capacity(2, 0);
+/// let pkg_id = builder.add_element(Element::new_with_kind(ElementKind::Package).with_name("P"));
+/// builder.add_element(
+///     Element::new_with_kind(ElementKind::PartUsage).with_owner(pkg_id.clone()),
+/// );
+///
+/// let graph = builder.build();
+/// assert_eq!(graph.element_count(), 2);
+/// assert_eq!(graph.children_of(&pkg_id).count(), 1);
+/// ```
+#[derive(Debug, Clone, Default)]
+pub struct GraphBuilder {
+    elements: Vec<Element>,
+    relationships: Vec<Relationship>,
+}
+
+impl GraphBuilder {
+    /// Create an empty builder.
+    pub fn new() -> Self {
+        GraphBuilder::default()
+    }
+
+    /// Create a builder with pre-allocated capacity for the given counts.
+    pub fn with_capacity(elements: usize, relationships: usize) -> Self {
+        GraphBuilder {
+            elements: Vec::with_capacity(elements),
+            relationships: Vec::with_capacity(relationships),
+        }
+    }
+
+    /// Queue an element for insertion. Returns its id.
+    pub fn add_element(&mut self, element: Element) -> ElementId {
+        let id = element.id.clone();
+        self.elements.push(element);
+        id
+    }
+
+    /// Queue a relationship for insertion. Returns its id.
+    pub fn add_relationship(&mut self, relationship: Relationship) -> ElementId {
+        let id = relationship.id.clone();
+        self.relationships.push(relationship);
+        id
+    }
+
+    /// Queue all elements from an iterator.
+    pub fn extend_elements(&mut self, elements: impl IntoIterator<Item = Element>) {
+        self.elements.extend(elements);
+    }
+
+    /// Queue all relationships from an iterator.
+    pub fn extend_relationships(
+        &mut self,
+        relationships: impl IntoIterator<Item = Relationship>,
+    ) {
+        self.relationships.extend(relationships);
+    }
+
+    /// The number of queued elements.
+    pub fn element_count(&self) -> usize {
+        self.elements.len()
+    }
+
+    /// The number of queued relationships.
+    pub fn relationship_count(&self) -> usize {
+        self.relationships.len()
+    }
+
+    /// Build the graph, wiring all indexes in one pass.
+    pub fn build(self) -> ModelGraph {
+        let mut graph = ModelGraph::new();
+        graph.extend_from_iter(self.elements, self.relationships);
+        graph
+    }
+
+    /// Drain this builder into an existing graph.
+    pub fn build_into(self, graph: &mut ModelGraph) {
+        graph.extend_from_iter(self.elements, self.relationships);
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::{RelationshipKind, VisibilityKind};
+
+    /// Build the same model twice — once per-element, once in bulk — and
+    /// check that queries agree.
+    #[test]
+    fn bulk_load_matches_incremental() {
+        let pkg = Element::new_with_kind(ElementKind::Package).with_name("Pkg");
+        let pkg_id = pkg.id.clone();
+        let part = Element::new_with_kind(ElementKind::PartUsage)
+            .with_name("part")
+            .with_owner(pkg_id.clone());
+        let part_id = part.id.clone();
+        let req = Element::new_with_kind(ElementKind::RequirementUsage)
+            .with_name("req")
+            .with_owner(pkg_id.clone());
+        let req_id = req.id.clone();
+        let rel = Relationship::new(RelationshipKind::Satisfy, part_id.clone(), req_id.clone());
+
+        let mut incremental = ModelGraph::new();
+        incremental.add_element(pkg.clone());
+        incremental.add_element(part.clone());
+        incremental.add_element(req.clone());
+        incremental.add_relationship(rel.clone());
+
+        let mut bulk = GraphBuilder::with_capacity(3, 1);
+        bulk.add_element(pkg);
+        bulk.add_element(part);
+        bulk.add_element(req);
+        bulk.add_relationship(rel);
+        let bulk = bulk.build();
+
+        assert_eq!(bulk.element_count(), incremental.element_count());
+        assert_eq!(bulk.relationship_count(), incremental.relationship_count());
+
+        let mut bulk_children: Vec<_> =
+            bulk.children_of(&pkg_id).map(|e| e.id.clone()).collect();
+        let mut inc_children: Vec<_> =
+            incremental.children_of(&pkg_id).map(|e| e.id.clone()).collect();
+        bulk_children.sort();
+        inc_children.sort();
+        assert_eq!(bulk_children, inc_children);
+
+        assert_eq!(bulk.outgoing(&part_id).count(), 1);
+        assert_eq!(bulk.incoming(&req_id).count(), 1);
+    }
+
+    #[test]
+    fn bulk_load_wires_membership_indexes() {
+        // Build membership elements by hand, as a loader would, and check
+        // that deferred wiring produces the membership indexes.
+        let mut source = ModelGraph::new();
+        let pkg = Element::new_with_kind(ElementKind::Package).with_name("Pkg");
+        let pkg_id = source.add_element(pkg);
+        let part = Element::new_with_kind(ElementKind::PartUsage).with_name("part");
+        let part_id = source.add_owned_element(part, pkg_id.clone(), VisibilityKind::Public);
+
+        let mut bulk = GraphBuilder::new();
+        bulk.extend_elements(source.elements.values().cloned());
+        bulk.extend_relationships(source.relationships.values().cloned());
+        let bulk = bulk.build();
+
+        assert!(bulk.namespace_to_memberships.contains_key(&pkg_id));
+        assert!(bulk.element_to_owning_membership.contains_key(&part_id));
+        assert_eq!(bulk.owner_of(&part_id).unwrap().id, pkg_id);
+    }
+
+    #[test]
+    fn bulk_load_matches_rebuild() {
+        // The bulk path must produce the same indexes as a full rebuild.
+        let mut source = ModelGraph::new();
+        let pkg_id = source.add_element(
+            Element::new_with_kind(ElementKind::Package).with_name("Pkg"),
+        );
+        for i in 0..10 {
+            let part = Element::new_with_kind(ElementKind::PartUsage)
+                .with_name(format!("part{}", i))
+                .with_owner(pkg_id.clone());
+            source.add_element(part);
+        }
+
+        let mut bulk = ModelGraph::new();
+        bulk.extend_from_iter(source.elements.values().cloned(), []);
+
+        let mut rebuilt = ModelGraph::new();
+        rebuilt.elements = source.elements.clone();
+        rebuilt.rebuild_indexes();
+
+        let mut bulk_children: Vec<_> =
+            bulk.children_of(&pkg_id).map(|e| e.id.clone()).collect();
+        let mut rebuilt_children: Vec<_> =
+            rebuilt.children_of(&pkg_id).map(|e| e.id.clone()).collect();
+        bulk_children.sort();
+        rebuilt_children.sort();
+        assert_eq!(bulk_children, rebuilt_children);
+    }
+
+    #[test]
+    fn builder_counts_and_extend_into() {
+        let mut builder = GraphBuilder::new();
+        assert_eq!(builder.element_count(), 0);
+        let id = builder.add_element(Element::new_with_kind(ElementKind::Package));
+        assert_eq!(builder.element_count(), 1);
+        assert_eq!(builder.relationship_count(), 0);
+
+        let mut graph = ModelGraph::new();
+        builder.build_into(&mut graph);
+        assert!(graph.get_element(&id).is_some());
+    }
+}
@@ -22,18 +22,24 @@
 
 use std::collections::BTreeMap;
 
-use rustc_hash::{FxHashMap, FxHashSet};
+use rustc_hash::FxHashMap;
 
 #[cfg(feature = "serde")]
 use serde::{Deserialize, Serialize};
 
-pub use sysml_id::{ElementId, QualifiedName};
+pub use sysml_id::{ElementId, IdMap, IdSet, QualifiedName};
 pub use sysml_meta::Value;
-pub use sysml_span::Span;
+pub use sysml_span::{FileId, Span, Symbol};
 
 mod validation;
 pub use validation::{ValidationError, ValidationErrorKind, ValidationResult};
 
+// Arena-backed storage mode for traversal-heavy workloads
+mod arena;
+
+// Bulk ingestion of parsed corpora
+mod bulk;
+
 // Membership-based ownership modules (SysML v2 compliant)
 mod membership;
 mod ownership;
@@ -44,6 +50,8 @@ mod factory;
 // Name resolution module (Phase 2d)
 pub mod resolution;
 
+pub use arena::{ArenaGraph, ElementHandle, RelationshipHandle};
+pub use bulk::GraphBuilder;
 pub use membership::{MembershipBuilder, MembershipView, OwningMembershipView};
 pub use structural_validation::StructuralError;
 pub use factory::ElementFactory;
@@ -294,34 +302,34 @@ pub struct ModelGraph {
 
     // Indexes (built lazily, not serialized)
     #[cfg_attr(feature = "serde", serde(skip))]
-    owner_to_children: FxHashMap<ElementId, FxHashSet<ElementId>>,
+    owner_to_children: IdMap<IdSet>,
     #[cfg_attr(feature = "serde", serde(skip))]
-    source_to_rels: FxHashMap<ElementId, FxHashSet<ElementId>>,
+    source_to_rels: IdMap<IdSet>,
     #[cfg_attr(feature = "serde", serde(skip))]
-    target_to_rels: FxHashMap<ElementId, FxHashSet<ElementId>>,
+    target_to_rels: IdMap<IdSet>,
 
     // NEW: Membership-based ownership indexes
     /// Maps namespace ID to its membership element IDs.
     #[cfg_attr(feature = "serde", serde(skip))]
-    pub(crate) namespace_to_memberships: FxHashMap<ElementId, FxHashSet<ElementId>>,
+    pub(crate) namespace_to_memberships: IdMap<IdSet>,
     /// Maps element ID to its owning membership element ID.
     #[cfg_attr(feature = "serde", serde(skip))]
-    pub(crate) element_to_owning_membership: FxHashMap<ElementId, ElementId>,
+    pub(crate) element_to_owning_membership: IdMap<ElementId>,
 
     // Phase 1 Performance Optimization: Reverse indexes for O(1) relationship lookups
     /// Maps typed feature ID to FeatureTyping element IDs that type it.
     /// Used by find_feature_type() and find_feature_types() for O(1) lookup.
     #[cfg_attr(feature = "serde", serde(skip))]
-    pub(crate) typed_feature_to_typings: FxHashMap<ElementId, Vec<ElementId>>,
+    pub(crate) typed_feature_to_typings: IdMap<Vec<ElementId>>,
     /// Maps specific type ID to Specialization element IDs where it is the specific type.
     /// Used by find_general_types() for O(1) lookup.
     #[cfg_attr(feature = "serde", serde(skip))]
-    pub(crate) specific_to_specializations: FxHashMap<ElementId, Vec<ElementId>>,
+    pub(crate) specific_to_specializations: IdMap<Vec<ElementId>>,
 
     /// Set of root package IDs that are standard library packages.
     /// Library packages are available globally during name resolution.
-    #[cfg_attr(feature = "serde", serde(default, skip_serializing_if = "FxHashSet::is_empty"))]
-    library_packages: FxHashSet<ElementId>,
+    #[cfg_attr(feature = "serde", serde(default, skip_serializing_if = "IdSet::is_empty"))]
+    library_packages: IdSet,
 
     /// Pre-built index: name -> ElementId for all library members.
     /// This enables O(1) lookup instead of O(n) recursive search.
@@ -344,14 +352,14 @@ impl ModelGraph {
         ModelGraph {
             elements: BTreeMap::new(),
             relationships: BTreeMap::new(),
-            owner_to_children: FxHashMap::default(),
-            source_to_rels: FxHashMap::default(),
-            target_to_rels: FxHashMap::default(),
-            namespace_to_memberships: FxHashMap::default(),
-            element_to_owning_membership: FxHashMap::default(),
-            typed_feature_to_typings: FxHashMap::default(),
-            specific_to_specializations: FxHashMap::default(),
-            library_packages: FxHashSet::default(),
+            owner_to_children: IdMap::default(),
+            source_to_rels: IdMap::default(),
+            target_to_rels: IdMap::default(),
+            namespace_to_memberships: IdMap::default(),
+            element_to_owning_membership: IdMap::default(),
+            typed_feature_to_typings: IdMap::default(),
+            specific_to_specializations: IdMap::default(),
+            library_packages: IdSet::default(),
             library_name_index: FxHashMap::default(),
             library_index_dirty: true,
             indexes_dirty: false,
@@ -398,10 +406,120 @@ impl ModelGraph {
             }
         }
 
+        // Update membership-based ownership indexes
+        if let Some(membership_id) = &element.owning_membership {
+            self.element_to_owning_membership
+                .insert(id.clone(), membership_id.clone());
+        }
+        if element.kind == ElementKind::Membership
+            || element.kind.is_subtype_of(ElementKind::Membership)
+        {
+            if let Some(ns_ref) = element.props.get("membershipOwningNamespace") {
+                if let Some(ns_id) = ns_ref.as_ref() {
+                    self.namespace_to_memberships
+                        .entry(ns_id.clone())
+                        .or_default()
+                        .insert(id.clone());
+                }
+            }
+        }
+
         self.elements.insert(id.clone(), element);
         id
     }
 
+    /// Remove an element from the graph.
+    ///
+    /// All indexes are patched incrementally in O(affected entries); no full
+    /// rebuild is triggered. Relationships that reference the removed element
+    /// are left in place (remove them explicitly with
+    /// [`ModelGraph::remove_relationship`] if desired), as are child elements,
+    /// whose `owner` fields then dangle like any other unresolved reference.
+    ///
+    /// # Returns
+    ///
+    /// The removed element, or `None` if no element with that id exists.
+    pub fn remove_element(&mut self, id: &ElementId) -> Option<Element> {
+        let element = self.elements.remove(id)?;
+
+        // Patch the owner index: detach from the former owner's child set.
+        if let Some(owner) = &element.owner {
+            if let Some(children) = self.owner_to_children.get_mut(owner) {
+                children.remove(id);
+                if children.is_empty() {
+                    self.owner_to_children.remove(owner);
+                }
+            }
+        }
+        // The removed element can no longer be anyone's owner key.
+        self.owner_to_children.remove(id);
+
+        // Patch membership-based ownership indexes.
+        self.element_to_owning_membership.remove(id);
+        self.namespace_to_memberships.remove(id);
+        if element.kind == ElementKind::Membership
+            || element.kind.is_subtype_of(ElementKind::Membership)
+        {
+            if let Some(ns_id) = element
+                .props
+                .get("membershipOwningNamespace")
+                .and_then(|v| v.as_ref())
+            {
+                if let Some(memberships) = self.namespace_to_memberships.get_mut(ns_id) {
+                    memberships.remove(id);
+                    if memberships.is_empty() {
+                        self.namespace_to_memberships.remove(ns_id);
+                    }
+                }
+            }
+            if let Some(member_id) = element
+                .props
+                .get("memberElement")
+                .and_then(|v| v.as_ref())
+            {
+                if self.element_to_owning_membership.get(member_id) == Some(id) {
+                    self.element_to_owning_membership.remove(member_id);
+                }
+            }
+        }
+
+        // Patch the reverse index for FeatureTyping elements.
+        if element.kind == ElementKind::FeatureTyping
+            || element.kind.is_subtype_of(ElementKind::FeatureTyping)
+        {
+            if let Some(tf_id) = element.props.get("typedFeature").and_then(|v| v.as_ref()) {
+                if let Some(typings) = self.typed_feature_to_typings.get_mut(tf_id) {
+                    typings.retain(|t| t != id);
+                    if typings.is_empty() {
+                        self.typed_feature_to_typings.remove(tf_id);
+                    }
+                }
+            }
+        }
+
+        // Patch the reverse index for Specialization elements.
+        if element.kind == ElementKind::Specialization
+            || element.kind.is_subtype_of(ElementKind::Specialization)
+        {
+            if let Some(specific_id) = element.props.get("specific").and_then(|v| v.as_ref()) {
+                if let Some(specs) = self.specific_to_specializations.get_mut(specific_id) {
+                    specs.retain(|s| s != id);
+                    if specs.is_empty() {
+                        self.specific_to_specializations.remove(specific_id);
+                    }
+                }
+            }
+        }
+
+        // If the element was a registered library package, the library name
+        // index no longer matches and must be rebuilt on next use.
+        if self.library_packages.remove(id) {
+            self.library_index_dirty = true;
+        }
+
+        Some(element)
+    }
+
     /// Add a relationship to the graph.
     pub fn add_relationship(&mut self, relationship: Relationship) -> ElementId {
         let id = relationship.id.clone();
@@ -422,6 +540,33 @@ impl ModelGraph {
         id
     }
 
+    /// Remove a relationship from the graph.
+    ///
+    /// The source and target indexes are patched incrementally in
+    /// O(affected entries); no full rebuild is triggered.
+    ///
+    /// # Returns
+    ///
+    /// The removed relationship, or `None` if no relationship with that id exists.
+    pub fn remove_relationship(&mut self, id: &ElementId) -> Option<Relationship> {
+        let relationship = self.relationships.remove(id)?;
+
+        if let Some(rels) = self.source_to_rels.get_mut(&relationship.source) {
+            rels.remove(id);
+            if rels.is_empty() {
+                self.source_to_rels.remove(&relationship.source);
+            }
+        }
+        if let Some(rels) = self.target_to_rels.get_mut(&relationship.target) {
+            rels.remove(id);
+            if rels.is_empty() {
+                self.target_to_rels.remove(&relationship.target);
+            }
+        }
+
+        Some(relationship)
+    }
+
     /// Get an element by id.
     pub fn get_element(&self, id: &ElementId) -> Option<&Element> {
         self.elements.get(id)
@@ -494,7 +639,13 @@ impl ModelGraph {
         self.elements.is_empty() && self.relationships.is_empty()
     }
 
-    /// Rebuild indexes after deserialization.
+    /// Rebuild every index from scratch.
+    ///
+    /// All mutation paths (`add_element`, `add_relationship`,
+    /// `remove_element`, `remove_relationship`, and the ownership helpers)
+    /// maintain the indexes incrementally, so this is only needed as a
+    /// recovery path — e.g. after deserialization, or after editing the
+    /// public `elements`/`relationships` maps directly.
     pub fn rebuild_indexes(&mut self) {
         self.owner_to_children.clear();
         self.source_to_rels.clear();
@@ -640,7 +791,7 @@ impl ModelGraph {
     }
 
     /// Get all library package IDs.
-    pub fn library_packages(&self) -> &FxHashSet<ElementId> {
+    pub fn library_packages(&self) -> &IdSet {
         &self.library_packages
     }
 
@@ -658,7 +809,7 @@ impl ModelGraph {
     /// to element IDs for fast resolution.
     pub fn build_library_index(&mut self) {
         self.library_name_index.clear();
-        let mut visited = FxHashSet::default();
+        let mut visited = IdSet::default();
 
         // Clone the library_packages to avoid borrow issues
         let lib_pkg_ids: Vec<ElementId> = self.library_packages.iter().cloned().collect();
@@ -685,7 +836,7 @@ impl ModelGraph {
     fn index_library_recursively(
         &mut self,
         namespace_id: &ElementId,
-        visited: &mut FxHashSet<ElementId>,
+        visited: &mut IdSet,
     ) {
         if !visited.insert(namespace_id.clone()) {
             return; // Already visited, prevent cycles
@@ -801,6 +952,23 @@ impl ModelGraph {
         self.library_index_dirty && !self.library_packages.is_empty()
     }
 
+    /// Access the library name index (name -> element).
+    ///
+    /// Used by the resolution cache to snapshot the index; empty until
+    /// `ensure_library_index()` has run.
+    pub fn library_name_index(&self) -> &FxHashMap<String, ElementId> {
+        &self.library_name_index
+    }
+
+    /// Install a previously captured library name index and mark it clean.
+    ///
+    /// Used when restoring a resolution cache snapshot so resolution does
+    /// not re-walk the library packages to rebuild the index.
+    pub fn restore_library_index(&mut self, index: FxHashMap<String, ElementId>) {
+        self.library_name_index = index;
+        self.library_index_dirty = false;
+    }
+
     /// Add an element as a library package.
     ///
     /// This is a convenience method that combines `add_element` and
@@ -1360,6 +1528,122 @@ mod tests {
         );
     }
 
+    // === Tests for incremental index maintenance ===
+
+    #[test]
+    fn add_element_maintains_membership_indexes() {
+        let mut graph = ModelGraph::new();
+
+        let pkg = Element::new_with_kind(ElementKind::Package).with_name("Pkg");
+        let pkg_id = graph.add_element(pkg);
+
+        let part = Element::new_with_kind(ElementKind::PartUsage).with_name("Part");
+        let part_id = graph.add_owned_element(part, pkg_id.clone(), VisibilityKind::Public);
+
+        // Both membership indexes are populated without a rebuild.
+        assert!(graph.namespace_to_memberships.contains_key(&pkg_id));
+        assert!(graph.element_to_owning_membership.contains_key(&part_id));
+    }
+
+    #[test]
+    fn remove_element_patches_indexes() {
+        let mut graph = create_test_graph();
+        let pkg_id = graph
+            .elements_by_kind(&ElementKind::Package)
+            .next()
+            .unwrap()
+            .id
+            .clone();
+        let part_id = graph
+            .elements_by_kind(&ElementKind::PartUsage)
+            .next()
+            .unwrap()
+            .id
+            .clone();
+
+        let removed = graph.remove_element(&part_id).unwrap();
+        assert_eq!(removed.id, part_id);
+
+        assert!(graph.get_element(&part_id).is_none());
+        assert_eq!(graph.element_count(), 2);
+        // The package's child set no longer contains the removed part.
+        assert!(graph.children_of(&pkg_id).all(|c| c.id != part_id));
+
+        // Removing a missing element is a no-op.
+        assert!(graph.remove_element(&part_id).is_none());
+    }
+
+    #[test]
+    fn remove_element_patches_typing_index() {
+        let mut graph = ModelGraph::new();
+
+        let feature = Element::new_with_kind(ElementKind::PartUsage).with_name("f");
+        let feature_id = graph.add_element(feature);
+
+        let typ = Element::new_with_kind(ElementKind::PartDefinition).with_name("T");
+        let type_id = graph.add_element(typ);
+
+        let typing = Element::new_with_kind(ElementKind::FeatureTyping)
+            .with_prop("typedFeature", feature_id.clone())
+            .with_prop("type", type_id.clone());
+        let typing_id = graph.add_element(typing);
+
+        assert!(graph.typed_feature_to_typings.contains_key(&feature_id));
+        graph.remove_element(&typing_id);
+        assert!(!graph.typed_feature_to_typings.contains_key(&feature_id));
+    }
+
+    #[test]
+    fn remove_relationship_patches_indexes() {
+        let mut graph = create_test_graph();
+        let part_id = graph
+            .elements_by_kind(&ElementKind::PartUsage)
+            .next()
+            .unwrap()
+            .id
+            .clone();
+        let rel_id = graph.outgoing(&part_id).next().unwrap().id.clone();
+
+        let removed = graph.remove_relationship(&rel_id).unwrap();
+        assert_eq!(removed.id, rel_id);
+
+        assert!(graph.get_relationship(&rel_id).is_none());
+        assert_eq!(graph.outgoing(&part_id).count(), 0);
+        assert_eq!(graph.relationship_count(), 0);
+
+        assert!(graph.remove_relationship(&rel_id).is_none());
+    }
+
+    #[test]
+    fn removal_matches_rebuild() {
+        // After removals, an explicit rebuild must not change query results.
+        let mut graph = create_test_graph();
+        let req_id = graph
+            .elements_by_kind(&ElementKind::RequirementUsage)
+            .next()
+            .unwrap()
+            .id
+            .clone();
+        let pkg_id = graph
+            .elements_by_kind(&ElementKind::Package)
+            .next()
+            .unwrap()
+            .id
+            .clone();
+
+        graph.remove_element(&req_id);
+
+        let incremental: Vec<_> = graph.children_of(&pkg_id).map(|e| e.id.clone()).collect();
+        graph.rebuild_indexes();
+        let rebuilt: Vec<_> = graph.children_of(&pkg_id).map(|e| e.id.clone()).collect();
+
+        let mut incremental = incremental;
+        let mut rebuilt = rebuilt;
+        incremental.sort();
+        rebuilt.sort();
+        assert_eq!(incremental, rebuilt);
+    }
+
     #[test]
     fn merge_as_library_registers_root_packages() {
         let mut graph1 = ModelGraph::new();
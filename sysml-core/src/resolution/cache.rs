@@ -0,0 +1,165 @@
+//! Snapshotting of resolved scope state for reuse across processes.
+//!
+//! The standard library is immutable, yet every process start pays to
+//! re-derive its `ScopeTable`s and the graph's library name index. A
+//! [`ResolutionCacheSnapshot`] captures that derived state so it can be
+//! serialized once (see `sysml-canon`), keyed by the graph's content hash,
+//! and loaded back on the next start without recomputation:
+//!
+//! 1. Resolve once, then call [`ResolutionContext::snapshot`] with the
+//!    content hash of the graph (from `sysml_canon::content_hash`).
+//! 2. Persist the snapshot (with the `serde` feature it serializes like any
+//!    other model type).
+//! 3. On the next start, check [`ResolutionCacheSnapshot::is_compatible`]
+//!    against the freshly computed hash, install the library index with
+//!    [`ResolutionCacheSnapshot::install_library_index`], and seed the
+//!    context with [`ResolutionContext::with_snapshot`].
+
+use std::collections::HashMap;
+
+use sysml_id::ElementId;
+
+#[cfg(feature = "serde")]
+use serde::{Deserialize, Serialize};
+
+use super::{ResolutionContext, ScopeTable};
+use crate::ModelGraph;
+
+/// Version of the snapshot layout.
+///
+/// Bump whenever `ScopeTable` or the snapshot structure changes shape;
+/// loaders must reject snapshots with a different version.
+pub const RESOLUTION_CACHE_VERSION: u32 = 1;
+
+/// A serializable snapshot of resolved scope state.
+///
+/// Contains every populated `ScopeTable` of a [`ResolutionContext`] plus the
+/// graph's library name index, keyed by the content hash of the graph they
+/// were derived from. A snapshot is only valid for a graph with the exact
+/// same content hash.
+#[derive(Debug, Clone)]
+#[cfg_attr(feature = "serde", derive(Serialize, Deserialize))]
+pub struct ResolutionCacheSnapshot {
+    /// Snapshot layout version ([`RESOLUTION_CACHE_VERSION`]).
+    pub version: u32,
+    /// Content hash of the graph this snapshot was derived from.
+    pub content_hash: u64,
+    /// Populated scope tables, per namespace.
+    scope_tables: HashMap<ElementId, ScopeTable>,
+    /// The graph's library name index (name -> element).
+    library_name_index: HashMap<String, ElementId>,
+}
+
+impl ResolutionCacheSnapshot {
+    /// Check that this snapshot can be used for a graph with the given
+    /// content hash.
+    pub fn is_compatible(&self, content_hash: u64) -> bool {
+        self.version == RESOLUTION_CACHE_VERSION && self.content_hash == content_hash
+    }
+
+    /// The number of cached scope tables.
+    pub fn scope_table_count(&self) -> usize {
+        self.scope_tables.len()
+    }
+
+    /// Install the snapshotted library name index into a graph, marking the
+    /// index clean so resolution will not rebuild it.
+    ///
+    /// Call this before resolving against the restored graph.
+    pub fn install_library_index(&self, graph: &mut ModelGraph) {
+        graph.restore_library_index(
+            self.library_name_index
+                .iter()
+                .map(|(name, id)| (name.clone(), id.clone()))
+                .collect(),
+        );
+    }
+}
+
+impl<'a> ResolutionContext<'a> {
+    /// Capture the populated scope tables (and the graph's library name
+    /// index) as a snapshot keyed by `content_hash`.
+    ///
+    /// `content_hash` should come from `sysml_canon::content_hash` on the
+    /// same graph this context resolves against.
+    pub fn snapshot(&self, content_hash: u64) -> ResolutionCacheSnapshot {
+        ResolutionCacheSnapshot {
+            version: RESOLUTION_CACHE_VERSION,
+            content_hash,
+            scope_tables: self.scope_tables.clone(),
+            library_name_index: self
+                .graph
+                .library_name_index()
+                .iter()
+                .map(|(name, id)| (name.clone(), id.clone()))
+                .collect(),
+        }
+    }
+
+    /// Create a resolution context pre-seeded with the scope tables from a
+    /// snapshot.
+    ///
+    /// The caller is responsible for checking
+    /// [`ResolutionCacheSnapshot::is_compatible`] against the graph's
+    /// current content hash first, and for installing the library index
+    /// with [`ResolutionCacheSnapshot::install_library_index`].
+    pub fn with_snapshot(graph: &'a ModelGraph, snapshot: ResolutionCacheSnapshot) -> Self {
+        let mut context = ResolutionContext::new(graph);
+        context.scope_tables = snapshot.scope_tables;
+        context
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::{Element, ElementKind, VisibilityKind};
+
+    fn library_graph() -> (ModelGraph, ElementId, ElementId) {
+        let mut graph = ModelGraph::new();
+        let lib = Element::new_with_kind(ElementKind::Package).with_name("Lib");
+        let lib_id = graph.add_element(lib);
+        let part = Element::new_with_kind(ElementKind::PartDefinition).with_name("Base");
+        let part_id = graph.add_owned_element(part, lib_id.clone(), VisibilityKind::Public);
+        graph.register_library_package(lib_id.clone());
+        graph.ensure_library_index();
+        (graph, lib_id, part_id)
+    }
+
+    #[test]
+    fn snapshot_round_trip_seeds_context() {
+        let (graph, lib_id, part_id) = library_graph();
+
+        // Populate scope tables by resolving once.
+        let mut context = ResolutionContext::new(&graph);
+        context.get_full_scope_table(&lib_id);
+        let snapshot = context.snapshot(42);
+
+        assert!(snapshot.is_compatible(42));
+        assert!(!snapshot.is_compatible(43));
+        assert!(snapshot.scope_table_count() >= 1);
+
+        // A fresh graph (same content) restored from the snapshot resolves
+        // library names without rebuilding anything.
+        let mut restored_graph = graph.clone();
+        restored_graph.rebuild_indexes();
+        snapshot.install_library_index(&mut restored_graph);
+        assert!(!restored_graph.library_index_needs_rebuild());
+        assert_eq!(restored_graph.resolve_in_library("Base"), Some(&part_id));
+
+        let mut restored = ResolutionContext::with_snapshot(&restored_graph, snapshot);
+        let table = restored.get_full_scope_table(&lib_id);
+        assert_eq!(table.lookup_owned("Base"), Some(&part_id));
+    }
+
+    #[test]
+    fn version_mismatch_is_incompatible() {
+        let (graph, lib_id, _) = library_graph();
+        let mut context = ResolutionContext::new(&graph);
+        context.get_scope_table(&lib_id);
+
+        let mut snapshot = context.snapshot(7);
+        snapshot.version = RESOLUTION_CACHE_VERSION + 1;
+        assert!(!snapshot.is_compatible(7));
+    }
+}
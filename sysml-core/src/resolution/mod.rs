@@ -67,8 +67,11 @@
 //!
 //! This will print detailed information about each resolution step.
 
+pub mod cache;
 pub mod scoping;
 
+pub use cache::{ResolutionCacheSnapshot, RESOLUTION_CACHE_VERSION};
+
 // Resolution tracing macros - enabled with the `resolution-tracing` feature
 #[cfg(feature = "resolution-tracing")]
 macro_rules! res_trace {
@@ -89,10 +92,10 @@ use std::cell::RefCell;
 use std::collections::{HashMap, HashSet};
 
 use sysml_id::ElementId;
-use sysml_span::{Diagnostic, Diagnostics};
+use sysml_span::{Diagnostic, Diagnostics, Symbol};
 
 use crate::membership::MembershipView;
-use crate::{ElementKind, ModelGraph, VisibilityKind};
+use crate::{Element, ElementKind, ModelGraph, VisibilityKind};
 
 /// Property keys for unresolved references (as stored by parser).
 pub mod unresolved_props {
@@ -403,18 +406,23 @@ pub mod resolved_props {
 ///
 /// This caches the expanded set of visible names in a namespace,
 /// including members imported from other namespaces.
+///
+/// Names are stored as interned [`Symbol`]s, so each map key is 4 bytes and
+/// lookups hash an integer instead of re-hashing the name string in every
+/// map that is consulted.
 #[derive(Debug, Default, Clone)]
+#[cfg_attr(feature = "serde", derive(serde::Serialize, serde::Deserialize))]
 pub struct ScopeTable {
     /// Direct owned members: name -> element ID.
-    owned: HashMap<String, ElementId>,
+    owned: HashMap<Symbol, ElementId>,
     /// Short names of owned members: short_name -> element ID.
-    owned_short: HashMap<String, ElementId>,
+    owned_short: HashMap<Symbol, ElementId>,
     /// Imported members: name -> (element ID, visibility).
-    imported: HashMap<String, (ElementId, VisibilityKind)>,
+    imported: HashMap<Symbol, (ElementId, VisibilityKind)>,
     /// Imported members by short name.
-    imported_short: HashMap<String, (ElementId, VisibilityKind)>,
+    imported_short: HashMap<Symbol, (ElementId, VisibilityKind)>,
     /// Inherited members (via Specialization): name -> element ID.
-    inherited: HashMap<String, ElementId>,
+    inherited: HashMap<Symbol, ElementId>,
     /// Whether this scope table has been fully populated (owned members).
     populated: bool,
     /// Whether inherited members have been populated.
@@ -430,52 +438,62 @@ impl ScopeTable {
     }
 
     /// Add an owned member.
-    pub fn add_owned(&mut self, name: String, id: ElementId) {
-        self.owned.insert(name, id);
+    pub fn add_owned(&mut self, name: impl Into<Symbol>, id: ElementId) {
+        self.owned.insert(name.into(), id);
     }
 
     /// Add an owned member by short name.
-    pub fn add_owned_short(&mut self, short_name: String, id: ElementId) {
-        self.owned_short.insert(short_name, id);
+    pub fn add_owned_short(&mut self, short_name: impl Into<Symbol>, id: ElementId) {
+        self.owned_short.insert(short_name.into(), id);
     }
 
     /// Add an imported member.
-    pub fn add_imported(&mut self, name: String, id: ElementId, visibility: VisibilityKind) {
-        self.imported.insert(name, (id, visibility));
+    pub fn add_imported(
+        &mut self,
+        name: impl Into<Symbol>,
+        id: ElementId,
+        visibility: VisibilityKind,
+    ) {
+        self.imported.insert(name.into(), (id, visibility));
     }
 
     /// Add an imported member by short name.
     pub fn add_imported_short(
         &mut self,
-        short_name: String,
+        short_name: impl Into<Symbol>,
         id: ElementId,
         visibility: VisibilityKind,
     ) {
-        self.imported_short.insert(short_name, (id, visibility));
+        self.imported_short.insert(short_name.into(), (id, visibility));
     }
 
     /// Add an inherited member.
-    pub fn add_inherited(&mut self, name: String, id: ElementId) {
-        self.inherited.insert(name, id);
+    pub fn add_inherited(&mut self, name: impl Into<Symbol>, id: ElementId) {
+        self.inherited.insert(name.into(), id);
     }
 
-    /// Try looking up a name in a HashMap, also checking quoted/unquoted variants.
-    fn lookup_with_quote_variants<'a, V>(map: &'a HashMap<String, V>, name: &str) -> Option<&'a V> {
+    /// Try looking up a name in a symbol-keyed map, also checking
+    /// quoted/unquoted variants.
+    ///
+    /// Uses `Symbol::get` (no insertion): a name that was never interned
+    /// cannot be in any scope table, so misses neither grow the interner
+    /// nor hash more than once.
+    fn lookup_with_quote_variants<'a, V>(map: &'a HashMap<Symbol, V>, name: &str) -> Option<&'a V> {
         // Try exact match first
-        if let Some(v) = map.get(name) {
+        if let Some(v) = Symbol::get(name).and_then(|sym| map.get(&sym)) {
             return Some(v);
         }
         // Try with quotes stripped
         let stripped = name.trim_matches('\'');
         if stripped != name {
-            if let Some(v) = map.get(stripped) {
+            if let Some(v) = Symbol::get(stripped).and_then(|sym| map.get(&sym)) {
                 return Some(v);
             }
         }
         // Try with quotes added
         let quoted = format!("'{}'", stripped);
         if quoted != name {
-            map.get(&quoted)
+            Symbol::get(&quoted).and_then(|sym| map.get(&sym))
         } else {
             None
         }
@@ -651,6 +669,12 @@ pub struct ResolutionContext<'a> {
     /// Pre-computed inheritance index for O(1) supertype lookup.
     /// Lazily built on first use.
     inheritance_index: Option<InheritanceIndex>,
+    /// Provenance: source namespace -> scopes whose tables imported or
+    /// inherited from it. Drives [`ResolutionContext::invalidate`].
+    scope_dependents: HashMap<ElementId, HashSet<ElementId>>,
+    /// Reverse provenance: scope -> the sources its table drew from.
+    /// Used to drop stale edges when a table is evicted.
+    scope_sources: HashMap<ElementId, HashSet<ElementId>>,
 }
 
 impl<'a> ResolutionContext<'a> {
@@ -666,6 +690,8 @@ impl<'a> ResolutionContext<'a> {
             import_cache: RefCell::new(HashMap::new()),
             failed_lookups: RefCell::new(HashSet::new()),
             inheritance_index: None,
+            scope_dependents: HashMap::new(),
+            scope_sources: HashMap::new(),
         }
     }
 
@@ -770,12 +796,19 @@ impl<'a> ResolutionContext<'a> {
                 let mut visited = HashSet::new();
                 self.expand_inherited(namespace_id, &mut table, &mut visited, &redefined, 0);
                 table.set_inherited_populated();
+                // Every visited type is a provenance source: if it changes,
+                // this table's inherited members are stale.
+                visited.remove(namespace_id);
+                self.record_scope_dependencies(namespace_id, visited);
             }
 
             if needs_imported {
                 let mut visited = HashSet::new();
                 self.expand_imports(namespace_id, &mut table, &mut visited);
                 table.set_imported_populated();
+                // Visited ids cover the Import elements and every namespace
+                // whose members were pulled in; all of them are sources.
+                self.record_scope_dependencies(namespace_id, visited);
             }
 
             self.scope_tables.insert(namespace_id.clone(), table);
@@ -784,6 +817,97 @@ impl<'a> ResolutionContext<'a> {
         self.scope_tables.get(namespace_id).unwrap()
     }
 
+    /// Record that `dependent`'s scope table drew members from `sources`.
+    ///
+    /// Edges are added as tables are populated, so invalidation can follow
+    /// import/inherit provenance without a separate analysis pass.
+    fn record_scope_dependencies(
+        &mut self,
+        dependent: &ElementId,
+        sources: impl IntoIterator<Item = ElementId>,
+    ) {
+        for source in sources {
+            self.scope_dependents
+                .entry(source.clone())
+                .or_default()
+                .insert(dependent.clone());
+            self.scope_sources
+                .entry(dependent.clone())
+                .or_default()
+                .insert(source);
+        }
+    }
+
+    /// Evict the cached scope table for a single scope and drop its
+    /// provenance edges. Returns `true` if a table was cached.
+    fn evict_scope_table(&mut self, scope_id: &ElementId) -> bool {
+        if let Some(sources) = self.scope_sources.remove(scope_id) {
+            for source in sources {
+                if let Some(dependents) = self.scope_dependents.get_mut(&source) {
+                    dependents.remove(scope_id);
+                    if dependents.is_empty() {
+                        self.scope_dependents.remove(&source);
+                    }
+                }
+            }
+        }
+        self.scope_tables.remove(scope_id).is_some()
+    }
+
+    /// Invalidate the cached scope tables affected by an edit to an element.
+    ///
+    /// Evicts the scope table of `namespace_id` itself plus — following the
+    /// provenance recorded by [`get_full_scope_table`](Self::get_full_scope_table)
+    /// — every scope that imported or inherited from it, transitively.
+    /// Untouched scopes keep their tables, so re-resolution after an edit
+    /// only rebuilds the invalidated subset (lazily, on the next
+    /// `get_scope_table`/`get_full_scope_table` call).
+    ///
+    /// Returns the number of scope tables evicted.
+    ///
+    /// Note: tables seeded from a [`ResolutionCacheSnapshot`] carry no
+    /// provenance edges; that is fine for the standard library (immutable by
+    /// definition) but means snapshot-seeded tables are only evicted when
+    /// invalidated directly.
+    pub fn invalidate(&mut self, namespace_id: &ElementId) -> usize {
+        // Collect the transitive closure of dependents first, then evict.
+        let mut affected = vec![namespace_id.clone()];
+        let mut seen: HashSet<ElementId> = affected.iter().cloned().collect();
+        let mut index = 0;
+        while index < affected.len() {
+            let current = affected[index].clone();
+            index += 1;
+            if let Some(dependents) = self.scope_dependents.get(&current) {
+                for dependent in dependents {
+                    if seen.insert(dependent.clone()) {
+                        affected.push(dependent.clone());
+                    }
+                }
+            }
+        }
+
+        let mut evicted = 0;
+        for scope_id in &affected {
+            if self.evict_scope_table(scope_id) {
+                evicted += 1;
+            }
+        }
+
+        // The qualified-name and negative-lookup caches are global; any edit
+        // can turn a previous miss into a hit, so drop them wholesale. They
+        // are cheap to refill compared to scope table expansion.
+        self.import_cache.borrow_mut().clear();
+        self.failed_lookups.borrow_mut().clear();
+        self.inheritance_index = None;
+
+        evicted
+    }
+
+    /// The number of scope tables currently cached.
+    pub fn cached_scope_table_count(&self) -> usize {
+        self.scope_tables.len()
+    }
+
     /// Build a scope table for a namespace by collecting owned members.
     fn build_scope_table(&self, namespace_id: &ElementId) -> ScopeTable {
         let mut table = ScopeTable::new();
@@ -874,7 +998,10 @@ impl<'a> ResolutionContext<'a> {
                             visited_imports,
                         );
                     } else {
-                        // Membership import: import the specific element
+                        // Membership import: import the specific element.
+                        // Record the target in `visited_imports` so it is
+                        // tracked as a provenance source for invalidation.
+                        visited_imports.insert(target_id.clone());
                         if let Some(target) = self.graph.get_element(&target_id) {
                             if let Some(name) = &target.name {
                                 table.add_imported(
@@ -1970,6 +2097,246 @@ impl ModelGraph {
     }
 }
 
+/// Resolve the type relationships of a single element (resolution pass 1).
+///
+/// Handles FeatureTyping, Specialization, and Subclassification — the
+/// relationships that establish inheritance chains. Shared by the
+/// sequential and parallel resolution drivers.
+fn resolve_type_relationship_element(
+    element: &Element,
+    scope_id: &ElementId,
+    ctx: &mut ResolutionContext,
+    updates: &mut Vec<(ElementId, String, ElementId)>,
+    unresolved: &mut Vec<(ElementId, String, String)>,
+) {
+    match &element.kind {
+        // FeatureTyping must come before Specialization (it's a subtype)
+        k if k == &ElementKind::FeatureTyping || k.is_subtype_of(ElementKind::FeatureTyping) => {
+            resolve_feature_typing(element, scope_id, ctx, updates, unresolved);
+        }
+        // Specialization (general type relationship)
+        k if k == &ElementKind::Specialization || k.is_subtype_of(ElementKind::Specialization) => {
+            // Skip subtypes already handled (FeatureTyping, Subsetting, etc.)
+            // We only want pure Specialization here
+            if !k.is_subtype_of(ElementKind::Subsetting) {
+                resolve_specialization(element, scope_id, ctx, updates, unresolved);
+            }
+        }
+        // Subclassification (classifier inheritance)
+        k if k == &ElementKind::Subclassification
+            || k.is_subtype_of(ElementKind::Subclassification) =>
+        {
+            resolve_subclassification(element, scope_id, ctx, updates, unresolved);
+        }
+        _ => {}
+    }
+}
+
+/// Resolve the feature relationships and other cross-references of a single
+/// element (resolution pass 2).
+///
+/// Shared by the sequential and parallel resolution drivers. Assumes pass 1
+/// updates have already been applied to the graph so inherited members are
+/// visible in the scope tables.
+fn resolve_feature_relationship_element(
+    element: &Element,
+    scope_id: &ElementId,
+    ctx: &mut ResolutionContext,
+    updates: &mut Vec<(ElementId, String, ElementId)>,
+    unresolved: &mut Vec<(ElementId, String, String)>,
+) {
+    // NOTE: Order matters! More specific subtypes must come before more general supertypes.
+    // In KerML: Redefinition/ReferenceSubsetting <: Subsetting <: Specialization
+    match &element.kind {
+        // Most specific subtypes first
+        k if k == &ElementKind::Redefinition
+            || k.is_subtype_of(ElementKind::Redefinition) =>
+        {
+            resolve_redefinition(
+                element,
+                scope_id,
+                ctx,
+                updates,
+                unresolved,
+            );
+        }
+        k if k == &ElementKind::ReferenceSubsetting
+            || k.is_subtype_of(ElementKind::ReferenceSubsetting) =>
+        {
+            resolve_reference_subsetting(
+                element,
+                scope_id,
+                ctx,
+                updates,
+                unresolved,
+            );
+        }
+        k if k == &ElementKind::Subsetting || k.is_subtype_of(ElementKind::Subsetting) => {
+            resolve_subsetting(
+                element,
+                scope_id,
+                ctx,
+                updates,
+                unresolved,
+            );
+        }
+        // Dependency is a separate hierarchy
+        k if k == &ElementKind::Dependency || k.is_subtype_of(ElementKind::Dependency) => {
+            resolve_dependency(
+                element,
+                scope_id,
+                ctx,
+                updates,
+                unresolved,
+            );
+        }
+
+        // === Additional cross-reference resolution ===
+
+        // Conjugation (conjugatedType, originalType)
+        k if k == &ElementKind::Conjugation
+            || k.is_subtype_of(ElementKind::Conjugation) =>
+        {
+            resolve_conjugation(
+                element,
+                scope_id,
+                ctx,
+                updates,
+                unresolved,
+            );
+        }
+
+        // TypeFeaturing (featuringType)
+        k if k == &ElementKind::TypeFeaturing
+            || k.is_subtype_of(ElementKind::TypeFeaturing) =>
+        {
+            resolve_type_featuring(
+                element,
+                scope_id,
+                ctx,
+                updates,
+                unresolved,
+            );
+        }
+
+        // Disjoining (disjoiningType)
+        k if k == &ElementKind::Disjoining || k.is_subtype_of(ElementKind::Disjoining) => {
+            resolve_disjoining(
+                element,
+                scope_id,
+                ctx,
+                updates,
+                unresolved,
+            );
+        }
+
+        // Unioning (unioningType)
+        k if k == &ElementKind::Unioning || k.is_subtype_of(ElementKind::Unioning) => {
+            resolve_unioning(
+                element,
+                scope_id,
+                ctx,
+                updates,
+                unresolved,
+            );
+        }
+
+        // Intersecting (intersectingType)
+        k if k == &ElementKind::Intersecting
+            || k.is_subtype_of(ElementKind::Intersecting) =>
+        {
+            resolve_intersecting(
+                element,
+                scope_id,
+                ctx,
+                updates,
+                unresolved,
+            );
+        }
+
+        // Differencing (differencingType)
+        k if k == &ElementKind::Differencing
+            || k.is_subtype_of(ElementKind::Differencing) =>
+        {
+            resolve_differencing(
+                element,
+                scope_id,
+                ctx,
+                updates,
+                unresolved,
+            );
+        }
+
+        // FeatureInverting (invertingFeature)
+        k if k == &ElementKind::FeatureInverting
+            || k.is_subtype_of(ElementKind::FeatureInverting) =>
+        {
+            resolve_feature_inverting(
+                element,
+                scope_id,
+                ctx,
+                updates,
+                unresolved,
+            );
+        }
+
+        // FeatureChaining (crossedFeature)
+        k if k == &ElementKind::FeatureChaining
+            || k.is_subtype_of(ElementKind::FeatureChaining) =>
+        {
+            resolve_feature_chaining(
+                element,
+                scope_id,
+                ctx,
+                updates,
+                unresolved,
+            );
+        }
+
+        // Annotation (annotatedElement)
+        k if k == &ElementKind::Annotation || k.is_subtype_of(ElementKind::Annotation) => {
+            resolve_annotation(
+                element,
+                scope_id,
+                ctx,
+                updates,
+                unresolved,
+            );
+        }
+
+        // Membership (memberElement) - only for elements that have unresolved memberElement
+        k if (k == &ElementKind::Membership
+            || k == &ElementKind::OwningMembership
+            || k == &ElementKind::FeatureMembership
+            || k.is_subtype_of(ElementKind::Membership))
+            && element.props.contains_key(unresolved_props::MEMBER_ELEMENT) =>
+        {
+            resolve_membership(
+                element,
+                scope_id,
+                ctx,
+                updates,
+                unresolved,
+            );
+        }
+
+        // ConjugatedPortDefinition (conjugatedPortDefinition)
+        k if k == &ElementKind::ConjugatedPortDefinition
+            || k.is_subtype_of(ElementKind::ConjugatedPortDefinition) =>
+        {
+            resolve_conjugated_port_definition(
+                element,
+                scope_id,
+                ctx,
+                updates,
+                unresolved,
+            );
+        }
+
+        _ => {}
+    }
+}
+
 /// Resolve all unresolved references in a model graph.
 ///
 /// This function resolves all `unresolved_*` properties to concrete `ElementId`s
@@ -1996,11 +2363,11 @@ pub fn resolve_references(graph: &mut ModelGraph) -> ResolutionResult {
     let mut result = ResolutionResult::new();
 
     // Collect elements that need resolution (to avoid borrowing issues)
-    let elements_to_resolve: Vec<(ElementId, ElementKind)> = graph
+    let elements_to_resolve: Vec<ElementId> = graph
         .elements
         .iter()
         .filter(|(_, e)| has_unresolved_refs(e))
-        .map(|(id, e)| (id.clone(), e.kind.clone()))
+        .map(|(id, _)| id.clone())
         .collect();
 
     // =========================================================================
@@ -2015,7 +2382,7 @@ pub fn resolve_references(graph: &mut ModelGraph) -> ResolutionResult {
         let ctx_graph = &*graph;
         let mut ctx = ResolutionContext::new(ctx_graph);
 
-        for (element_id, kind) in &elements_to_resolve {
+        for element_id in &elements_to_resolve {
             let scope_id = ctx_graph
                 .get_element(element_id)
                 .and_then(|e| e.owner.clone())
@@ -2027,49 +2394,13 @@ pub fn resolve_references(graph: &mut ModelGraph) -> ResolutionResult {
             };
 
             // Pass 1: Only resolve type relationships
-            match kind {
-                // FeatureTyping must come before Specialization (it's a subtype)
-                k if k == &ElementKind::FeatureTyping
-                    || k.is_subtype_of(ElementKind::FeatureTyping) =>
-                {
-                    resolve_feature_typing(
-                        element,
-                        &scope_id,
-                        &mut ctx,
-                        &mut pass1_updates,
-                        &mut pass1_unresolved,
-                    );
-                }
-                // Specialization (general type relationship)
-                k if k == &ElementKind::Specialization
-                    || k.is_subtype_of(ElementKind::Specialization) =>
-                {
-                    // Skip subtypes already handled (FeatureTyping, Subsetting, etc.)
-                    // We only want pure Specialization here
-                    if !k.is_subtype_of(ElementKind::Subsetting) {
-                        resolve_specialization(
-                            element,
-                            &scope_id,
-                            &mut ctx,
-                            &mut pass1_updates,
-                            &mut pass1_unresolved,
-                        );
-                    }
-                }
-                // Subclassification (classifier inheritance)
-                k if k == &ElementKind::Subclassification
-                    || k.is_subtype_of(ElementKind::Subclassification) =>
-                {
-                    resolve_subclassification(
-                        element,
-                        &scope_id,
-                        &mut ctx,
-                        &mut pass1_updates,
-                        &mut pass1_unresolved,
-                    );
-                }
-                _ => {}
-            }
+            resolve_type_relationship_element(
+                element,
+                &scope_id,
+                &mut ctx,
+                &mut pass1_updates,
+                &mut pass1_unresolved,
+            );
         }
     }
 
@@ -2093,7 +2424,7 @@ pub fn resolve_references(graph: &mut ModelGraph) -> ResolutionResult {
         let ctx_graph = &*graph;
         let mut ctx = ResolutionContext::new(ctx_graph);
 
-        for (element_id, kind) in &elements_to_resolve {
+        for element_id in &elements_to_resolve {
             let scope_id = ctx_graph
                 .get_element(element_id)
                 .and_then(|e| e.owner.clone())
@@ -2105,214 +2436,203 @@ pub fn resolve_references(graph: &mut ModelGraph) -> ResolutionResult {
             };
 
             // Pass 2: Resolve feature relationships and other cross-references
-            // NOTE: Order matters! More specific subtypes must come before more general supertypes.
-            // In KerML: Redefinition/ReferenceSubsetting <: Subsetting <: Specialization
-            match kind {
-                // Most specific subtypes first
-                k if k == &ElementKind::Redefinition
-                    || k.is_subtype_of(ElementKind::Redefinition) =>
-                {
-                    resolve_redefinition(
-                        element,
-                        &scope_id,
-                        &mut ctx,
-                        &mut pass2_updates,
-                        &mut pass2_unresolved,
-                    );
-                }
-                k if k == &ElementKind::ReferenceSubsetting
-                    || k.is_subtype_of(ElementKind::ReferenceSubsetting) =>
-                {
-                    resolve_reference_subsetting(
-                        element,
-                        &scope_id,
-                        &mut ctx,
-                        &mut pass2_updates,
-                        &mut pass2_unresolved,
-                    );
-                }
-                k if k == &ElementKind::Subsetting || k.is_subtype_of(ElementKind::Subsetting) => {
-                    resolve_subsetting(
-                        element,
-                        &scope_id,
-                        &mut ctx,
-                        &mut pass2_updates,
-                        &mut pass2_unresolved,
-                    );
-                }
-                // Dependency is a separate hierarchy
-                k if k == &ElementKind::Dependency || k.is_subtype_of(ElementKind::Dependency) => {
-                    resolve_dependency(
-                        element,
-                        &scope_id,
-                        &mut ctx,
-                        &mut pass2_updates,
-                        &mut pass2_unresolved,
-                    );
-                }
-
-                // === Additional cross-reference resolution ===
-
-                // Conjugation (conjugatedType, originalType)
-                k if k == &ElementKind::Conjugation
-                    || k.is_subtype_of(ElementKind::Conjugation) =>
-                {
-                    resolve_conjugation(
-                        element,
-                        &scope_id,
-                        &mut ctx,
-                        &mut pass2_updates,
-                        &mut pass2_unresolved,
-                    );
-                }
-
-                // TypeFeaturing (featuringType)
-                k if k == &ElementKind::TypeFeaturing
-                    || k.is_subtype_of(ElementKind::TypeFeaturing) =>
-                {
-                    resolve_type_featuring(
-                        element,
-                        &scope_id,
-                        &mut ctx,
-                        &mut pass2_updates,
-                        &mut pass2_unresolved,
-                    );
-                }
+            resolve_feature_relationship_element(
+                element,
+                &scope_id,
+                &mut ctx,
+                &mut pass2_updates,
+                &mut pass2_unresolved,
+            );
+        }
 
-                // Disjoining (disjoiningType)
-                k if k == &ElementKind::Disjoining || k.is_subtype_of(ElementKind::Disjoining) => {
-                    resolve_disjoining(
-                        element,
-                        &scope_id,
-                        &mut ctx,
-                        &mut pass2_updates,
-                        &mut pass2_unresolved,
-                    );
-                }
+        // Take diagnostics from context
+        result.diagnostics = ctx.take_diagnostics();
+    }
 
-                // Unioning (unioningType)
-                k if k == &ElementKind::Unioning || k.is_subtype_of(ElementKind::Unioning) => {
-                    resolve_unioning(
-                        element,
-                        &scope_id,
-                        &mut ctx,
-                        &mut pass2_updates,
-                        &mut pass2_unresolved,
-                    );
-                }
+    // Apply pass 2 updates to the graph
+    for (element_id, prop_name, resolved_id) in pass2_updates {
+        if let Some(element) = graph.elements.get_mut(&element_id) {
+            element.set_prop(&prop_name, crate::Value::Ref(resolved_id));
+            result.resolved_count += 1;
+        }
+    }
 
-                // Intersecting (intersectingType)
-                k if k == &ElementKind::Intersecting
-                    || k.is_subtype_of(ElementKind::Intersecting) =>
-                {
-                    resolve_intersecting(
-                        element,
-                        &scope_id,
-                        &mut ctx,
-                        &mut pass2_updates,
-                        &mut pass2_unresolved,
-                    );
-                }
+    // Record all unresolved references as diagnostics
+    for (element_id, prop_name, unresolved_name) in
+        pass1_unresolved.into_iter().chain(pass2_unresolved)
+    {
+        let diag = build_unresolved_diagnostic(graph, &element_id, &prop_name, &unresolved_name);
+        result.diagnostics.push(diag);
+        result.unresolved_count += 1;
+    }
 
-                // Differencing (differencingType)
-                k if k == &ElementKind::Differencing
-                    || k.is_subtype_of(ElementKind::Differencing) =>
-                {
-                    resolve_differencing(
-                        element,
-                        &scope_id,
-                        &mut ctx,
-                        &mut pass2_updates,
-                        &mut pass2_unresolved,
-                    );
-                }
+    result
+}
 
-                // FeatureInverting (invertingFeature)
-                k if k == &ElementKind::FeatureInverting
-                    || k.is_subtype_of(ElementKind::FeatureInverting) =>
-                {
-                    resolve_feature_inverting(
-                        element,
-                        &scope_id,
-                        &mut ctx,
-                        &mut pass2_updates,
-                        &mut pass2_unresolved,
-                    );
-                }
+/// Resolve all unresolved references in parallel across root packages.
+///
+/// Root packages resolve largely independently — they only share the
+/// immutable standard library — so each root's elements are resolved on a
+/// rayon worker with its own `ResolutionContext` while sharing the graph
+/// (and its pre-built library name index) read-only. Both passes of
+/// [`resolve_references`] run this way; anything a partition could not
+/// resolve locally (typically cross-package references) is retried in a
+/// final sequential fix-up pass once every partition's updates have been
+/// applied.
+///
+/// Partitions are processed in root-id order and their diagnostics merged
+/// in that order, so the result is deterministic regardless of scheduling.
+///
+/// # Arguments
+///
+/// * `graph` - The model graph to resolve (mutable)
+///
+/// # Returns
+///
+/// A `ResolutionResult` containing statistics and diagnostics.
+pub fn resolve_references_parallel(graph: &mut ModelGraph) -> ResolutionResult {
+    use rayon::prelude::*;
 
-                // FeatureChaining (crossedFeature)
-                k if k == &ElementKind::FeatureChaining
-                    || k.is_subtype_of(ElementKind::FeatureChaining) =>
-                {
-                    resolve_feature_chaining(
-                        element,
-                        &scope_id,
-                        &mut ctx,
-                        &mut pass2_updates,
-                        &mut pass2_unresolved,
-                    );
-                }
+    let mut result = ResolutionResult::new();
 
-                // Annotation (annotatedElement)
-                k if k == &ElementKind::Annotation || k.is_subtype_of(ElementKind::Annotation) => {
-                    resolve_annotation(
-                        element,
-                        &scope_id,
-                        &mut ctx,
-                        &mut pass2_updates,
-                        &mut pass2_unresolved,
-                    );
+    // Build the shared library scope up front so worker contexts only read it.
+    graph.ensure_library_index();
+
+    // Partition elements needing resolution by their root package.
+    // BTreeMap keeps partitions in stable root-id order.
+    let mut partitions: std::collections::BTreeMap<ElementId, Vec<ElementId>> =
+        std::collections::BTreeMap::new();
+    for (id, element) in graph.elements.iter() {
+        if has_unresolved_refs(element) {
+            partitions
+                .entry(root_ancestor(graph, id))
+                .or_default()
+                .push(id.clone());
+        }
+    }
+    let partitions: Vec<Vec<ElementId>> = partitions.into_values().collect();
+
+    // Run one resolution pass over every partition in parallel, returning
+    // per-partition (updates, unresolved) in partition order.
+    type PassOutput = (
+        Vec<(ElementId, String, ElementId)>,
+        Vec<(ElementId, String, String)>,
+        Diagnostics,
+    );
+    let run_pass = |graph: &ModelGraph,
+                    partitions: &[Vec<ElementId>],
+                    resolve: fn(
+        &Element,
+        &ElementId,
+        &mut ResolutionContext,
+        &mut Vec<(ElementId, String, ElementId)>,
+        &mut Vec<(ElementId, String, String)>,
+    )|
+     -> Vec<PassOutput> {
+        partitions
+            .par_iter()
+            .map(|ids| {
+                let mut ctx = ResolutionContext::new(graph);
+                let mut updates = Vec::new();
+                let mut unresolved = Vec::new();
+                for element_id in ids {
+                    let scope_id = graph
+                        .get_element(element_id)
+                        .and_then(|e| e.owner.clone())
+                        .unwrap_or_else(|| element_id.clone());
+                    let element = match graph.get_element(element_id) {
+                        Some(e) => e,
+                        None => continue,
+                    };
+                    resolve(element, &scope_id, &mut ctx, &mut updates, &mut unresolved);
                 }
+                (updates, unresolved, ctx.take_diagnostics())
+            })
+            .collect()
+    };
 
-                // Membership (memberElement) - only for elements that have unresolved memberElement
-                k if (k == &ElementKind::Membership
-                    || k == &ElementKind::OwningMembership
-                    || k == &ElementKind::FeatureMembership
-                    || k.is_subtype_of(ElementKind::Membership))
-                    && element.props.contains_key(unresolved_props::MEMBER_ELEMENT) =>
-                {
-                    resolve_membership(
-                        element,
-                        &scope_id,
-                        &mut ctx,
-                        &mut pass2_updates,
-                        &mut pass2_unresolved,
-                    );
-                }
+    let mut unresolved_after_passes: Vec<(ElementId, String, String)> = Vec::new();
 
-                // ConjugatedPortDefinition (conjugatedPortDefinition)
-                k if k == &ElementKind::ConjugatedPortDefinition
-                    || k.is_subtype_of(ElementKind::ConjugatedPortDefinition) =>
-                {
-                    resolve_conjugated_port_definition(
-                        element,
-                        &scope_id,
-                        &mut ctx,
-                        &mut pass2_updates,
-                        &mut pass2_unresolved,
-                    );
-                }
+    // Pass 1: type relationships (establishes inheritance chains).
+    let pass1_outputs = run_pass(graph, &partitions, resolve_type_relationship_element);
+    for (updates, unresolved, diagnostics) in pass1_outputs {
+        for (element_id, prop_name, resolved_id) in updates {
+            if let Some(element) = graph.elements.get_mut(&element_id) {
+                element.set_prop(&prop_name, crate::Value::Ref(resolved_id));
+                result.resolved_count += 1;
+            }
+        }
+        unresolved_after_passes.extend(unresolved);
+        result.diagnostics.extend(diagnostics);
+    }
 
-                _ => {}
+    // Pass 2: feature relationships, now that inheritance chains are visible.
+    let pass2_outputs = run_pass(graph, &partitions, resolve_feature_relationship_element);
+    for (updates, unresolved, diagnostics) in pass2_outputs {
+        for (element_id, prop_name, resolved_id) in updates {
+            if let Some(element) = graph.elements.get_mut(&element_id) {
+                element.set_prop(&prop_name, crate::Value::Ref(resolved_id));
+                result.resolved_count += 1;
             }
         }
+        unresolved_after_passes.extend(unresolved);
+        result.diagnostics.extend(diagnostics);
+    }
 
-        // Take diagnostics from context
-        result.diagnostics = ctx.take_diagnostics();
+    // Sequential fix-up pass: retry whatever the partitions could not
+    // resolve, now that all partitions' updates are applied to the graph.
+    let mut retry_ids: Vec<ElementId> = unresolved_after_passes
+        .iter()
+        .map(|(id, _, _)| id.clone())
+        .collect();
+    retry_ids.sort();
+    retry_ids.dedup();
+
+    let mut fixup_updates: Vec<(ElementId, String, ElementId)> = Vec::new();
+    let mut still_unresolved: Vec<(ElementId, String, String)> = Vec::new();
+    {
+        let ctx_graph = &*graph;
+        let mut ctx = ResolutionContext::new(ctx_graph);
+        for element_id in &retry_ids {
+            let scope_id = ctx_graph
+                .get_element(element_id)
+                .and_then(|e| e.owner.clone())
+                .unwrap_or_else(|| element_id.clone());
+            let element = match ctx_graph.get_element(element_id) {
+                Some(e) => e,
+                None => continue,
+            };
+            resolve_type_relationship_element(
+                element,
+                &scope_id,
+                &mut ctx,
+                &mut fixup_updates,
+                &mut still_unresolved,
+            );
+            resolve_feature_relationship_element(
+                element,
+                &scope_id,
+                &mut ctx,
+                &mut fixup_updates,
+                &mut still_unresolved,
+            );
+        }
+        result.diagnostics.extend(ctx.take_diagnostics());
     }
 
-    // Apply pass 2 updates to the graph
-    for (element_id, prop_name, resolved_id) in pass2_updates {
+    for (element_id, prop_name, resolved_id) in fixup_updates {
         if let Some(element) = graph.elements.get_mut(&element_id) {
-            element.set_prop(&prop_name, crate::Value::Ref(resolved_id));
-            result.resolved_count += 1;
+            // The retry re-resolves every reference of the element; only
+            // count properties that were not already resolved in a pass.
+            if !element.props.contains_key(&prop_name) {
+                element.set_prop(&prop_name, crate::Value::Ref(resolved_id));
+                result.resolved_count += 1;
+            }
         }
     }
 
-    // Record all unresolved references as diagnostics
-    for (element_id, prop_name, unresolved_name) in
-        pass1_unresolved.into_iter().chain(pass2_unresolved)
-    {
+    // Record what is still unresolved after the fix-up as diagnostics.
+    for (element_id, prop_name, unresolved_name) in still_unresolved {
         let diag = build_unresolved_diagnostic(graph, &element_id, &prop_name, &unresolved_name);
         result.diagnostics.push(diag);
         result.unresolved_count += 1;
@@ -2321,6 +2641,19 @@ pub fn resolve_references(graph: &mut ModelGraph) -> ResolutionResult {
     result
 }
 
+/// Walk the owner chain of an element to its root.
+fn root_ancestor(graph: &ModelGraph, id: &ElementId) -> ElementId {
+    let mut current = id.clone();
+    let mut seen: HashSet<ElementId> = HashSet::new();
+    while let Some(owner) = graph.get_element(&current).and_then(|e| e.owner.clone()) {
+        if !seen.insert(current.clone()) {
+            break; // Ownership cycle; treat the revisited element as root.
+        }
+        current = owner;
+    }
+    current
+}
+
 /// Resolve all cross-references in a model graph, excluding specified elements.
 ///
 /// This is useful when resolving user-defined elements while excluding library
@@ -4586,4 +4919,155 @@ mod tests {
             "Should not crash on circular inheritance"
         );
     }
+
+    // === Incremental Invalidation Tests ===
+
+    #[test]
+    fn invalidate_evicts_importing_scopes_only() {
+        let mut graph = ModelGraph::new();
+
+        // LibPackage::Helper, imported wholesale by UserPackage.
+        let lib = Element::new_with_kind(ElementKind::Package).with_name("LibPackage");
+        let lib_id = graph.add_element(lib);
+        let helper = Element::new_with_kind(ElementKind::PartDefinition).with_name("Helper");
+        let helper_id = graph.add_owned_element(helper, lib_id.clone(), VisibilityKind::Public);
+
+        let user = Element::new_with_kind(ElementKind::Package).with_name("UserPackage");
+        let user_id = graph.add_element(user);
+        create_import(&mut graph, &user_id, "LibPackage", true, false);
+
+        // Unrelated package with no dependency on LibPackage.
+        let other = Element::new_with_kind(ElementKind::Package).with_name("Other");
+        let other_id = graph.add_element(other);
+
+        let mut ctx = graph.resolution_context();
+        ctx.get_full_scope_table(&lib_id);
+        ctx.get_full_scope_table(&user_id);
+        ctx.get_full_scope_table(&other_id);
+        let cached_before = ctx.cached_scope_table_count();
+
+        // Editing LibPackage must evict its own table and UserPackage's
+        // (which imported from it), but leave Other untouched.
+        let evicted = ctx.invalidate(&lib_id);
+        assert_eq!(evicted, 2);
+        assert_eq!(ctx.cached_scope_table_count(), cached_before - 2);
+
+        // Re-resolution rebuilds only the evicted scopes and still works.
+        assert_eq!(ctx.resolve_name(&user_id, "Helper"), Some(helper_id));
+    }
+
+    #[test]
+    fn invalidate_follows_inheritance_provenance() {
+        let mut graph = ModelGraph::new();
+
+        // PackageB::Derived :> PackageA::Base (resolved reference).
+        let pkg_a = Element::new_with_kind(ElementKind::Package).with_name("PackageA");
+        let pkg_a_id = graph.add_element(pkg_a);
+        let base = Element::new_with_kind(ElementKind::PartDefinition).with_name("Base");
+        let base_id = graph.add_owned_element(base, pkg_a_id.clone(), VisibilityKind::Public);
+
+        let pkg_b = Element::new_with_kind(ElementKind::Package).with_name("PackageB");
+        let pkg_b_id = graph.add_element(pkg_b);
+        let derived = Element::new_with_kind(ElementKind::PartDefinition).with_name("Derived");
+        let derived_id = graph.add_owned_element(derived, pkg_b_id.clone(), VisibilityKind::Public);
+        create_resolved_specialization(&mut graph, &derived_id, &base_id);
+
+        let mut ctx = graph.resolution_context();
+        ctx.get_full_scope_table(&derived_id);
+        ctx.get_full_scope_table(&pkg_b_id);
+        assert!(ctx.cached_scope_table_count() >= 2);
+
+        // Editing Base invalidates Derived's scope (it inherits from Base)
+        // but not PackageB's own table.
+        ctx.invalidate(&base_id);
+        assert_eq!(ctx.cached_scope_table_count(), 1);
+    }
+
+    // === Parallel Resolution Tests ===
+
+    #[test]
+    fn parallel_resolution_matches_sequential() {
+        let mut graph = ModelGraph::new();
+
+        // Four independent root packages, each with Base and Derived :> Base,
+        // plus a cross-package reference and one unresolvable name.
+        let mut pkgs = Vec::new();
+        for i in 0..4 {
+            let pkg = Element::new_with_kind(ElementKind::Package).with_name(format!("Pkg{}", i));
+            let pkg_id = graph.add_element(pkg);
+            let base = Element::new_with_kind(ElementKind::PartDefinition).with_name("Base");
+            let base_id = graph.add_owned_element(base, pkg_id.clone(), VisibilityKind::Public);
+            let derived = Element::new_with_kind(ElementKind::PartDefinition).with_name("Derived");
+            let derived_id =
+                graph.add_owned_element(derived, pkg_id.clone(), VisibilityKind::Public);
+            create_specialization(&mut graph, &derived_id, "Base");
+            pkgs.push((pkg_id, base_id, derived_id));
+        }
+
+        // Cross-package: Pkg0::Derived also specializes Pkg1::Base.
+        create_specialization(&mut graph, &pkgs[0].2, "Pkg1::Base");
+        // Unresolvable reference in Pkg2.
+        create_specialization(&mut graph, &pkgs[2].2, "NoSuchType");
+
+        let mut sequential = graph.clone();
+        let seq_result = resolve_references(&mut sequential);
+        let par_result = resolve_references_parallel(&mut graph);
+
+        assert_eq!(par_result.resolved_count, seq_result.resolved_count);
+        assert_eq!(par_result.unresolved_count, seq_result.unresolved_count);
+        assert_eq!(par_result.diagnostics.len(), seq_result.diagnostics.len());
+        assert_eq!(par_result.unresolved_count, 1);
+
+        // The resolved properties must be identical element-by-element.
+        for (id, element) in sequential.elements.iter() {
+            let parallel_element = graph.get_element(id).unwrap();
+            assert_eq!(
+                element.props, parallel_element.props,
+                "resolved props differ for {:?}",
+                element.kind
+            );
+        }
+    }
+
+    #[test]
+    fn parallel_resolution_is_deterministic() {
+        let build = || {
+            let mut graph = ModelGraph::new();
+            for i in 0..3 {
+                let pkg =
+                    Element::new_with_kind(ElementKind::Package).with_name(format!("P{}", i));
+                let pkg_id = graph.add_element(pkg);
+                let base = Element::new_with_kind(ElementKind::PartDefinition).with_name("B");
+                graph.add_owned_element(base, pkg_id.clone(), VisibilityKind::Public);
+                let derived =
+                    Element::new_with_kind(ElementKind::PartDefinition).with_name("D");
+                let derived_id =
+                    graph.add_owned_element(derived, pkg_id.clone(), VisibilityKind::Public);
+                create_specialization(&mut graph, &derived_id, "Missing");
+            }
+            graph
+        };
+
+        let mut first = build();
+        let first_result = resolve_references_parallel(&mut first);
+        let mut second = first.clone();
+        let second_result = resolve_references_parallel(&mut second);
+
+        let first_msgs: Vec<_> = first_result.diagnostics.iter().collect();
+        let second_msgs: Vec<_> = second_result.diagnostics.iter().collect();
+        assert_eq!(first_msgs, second_msgs, "diagnostic order must be stable");
+    }
+
+    #[test]
+    fn invalidate_unknown_namespace_is_noop_for_tables() {
+        let (graph, pkg_id, _, _) = create_test_hierarchy();
+
+        let mut ctx = graph.resolution_context();
+        ctx.get_full_scope_table(&pkg_id);
+        let cached = ctx.cached_scope_table_count();
+
+        let evicted = ctx.invalidate(&ElementId::new_v4());
+        assert_eq!(evicted, 0);
+        assert_eq!(ctx.cached_scope_table_count(), cached);
+    }
 }
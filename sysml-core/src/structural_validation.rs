@@ -537,9 +537,13 @@ impl ModelGraph {
     /// - Dangling references in memberships
     /// - Invalid owning_membership references
     ///
-    /// Performance: For graphs with >5000 elements, runs all 5 validation passes
-    /// in parallel using rayon, providing 3-5x speedup on multi-core systems.
-    /// For smaller graphs, runs sequentially to avoid thread pool overhead.
+    /// Performance: For graphs with >5000 elements, the per-element checks
+    /// run data-parallel over ownership-subtree partitions on the rayon
+    /// thread pool (work stealing balances uneven subtrees), while the
+    /// cycle and relationship passes run as sibling tasks. Partition
+    /// results are merged in partition order, so output is deterministic
+    /// for a given graph. For smaller graphs, runs sequentially to avoid
+    /// thread pool overhead.
     ///
     /// # Returns
     ///
@@ -567,53 +571,113 @@ impl ModelGraph {
     }
 
     /// Parallel validation for large graphs using rayon.
+    ///
+    /// The per-element checks (orphans, membership references, owning
+    /// membership references) are data-parallel: the graph is partitioned
+    /// by ownership subtree and the partitions are distributed over the
+    /// thread pool with work stealing. The ownership-cycle walk (which
+    /// needs a global visited set) and the relationship-endpoint pass run
+    /// as sibling tasks. Per-partition results are merged in partition
+    /// order, so the output is deterministic for a given graph.
     fn validate_structure_parallel(&self) -> Vec<StructuralError> {
-        // Run all validation passes in parallel using rayon::join
-        // Each pass is read-only (&self), so they're thread-safe
-        let (left_results, right_results) = rayon::join(
+        use rayon::prelude::*;
+
+        let partitions = self.ownership_partitions();
+
+        let (per_element, (cycle_errors, relationship_errors)) = rayon::join(
             || {
-                rayon::join(
-                    || self.collect_orphan_errors(),
-                    || self.collect_ownership_cycle_errors(),
-                )
+                partitions
+                    .par_iter()
+                    .map(|partition| {
+                        let mut errors = Vec::new();
+                        for element in partition {
+                            self.check_element(element, &mut errors);
+                        }
+                        errors
+                    })
+                    .collect::<Vec<_>>()
             },
             || {
                 rayon::join(
-                    || {
-                        rayon::join(
-                            || self.collect_membership_reference_errors(),
-                            || self.collect_owning_membership_reference_errors(),
-                        )
-                    },
+                    || self.collect_ownership_cycle_errors(),
                     || self.collect_relationship_reference_errors(),
                 )
             },
         );
 
-        // Combine all error vectors
-        let mut errors = left_results.0;
-        errors.extend(left_results.1);
-        errors.extend(right_results.0 .0);
-        errors.extend(right_results.0 .1);
-        errors.extend(right_results.1);
+        // Merge in partition order (deterministic), then the global passes.
+        let mut errors: Vec<StructuralError> = per_element.into_iter().flatten().collect();
+        errors.extend(cycle_errors);
+        errors.extend(relationship_errors);
         errors
     }
 
+    /// Partition elements by ownership subtree.
+    ///
+    /// Returns one partition per root element (in stable id order),
+    /// containing the root and everything transitively owned by it, plus a
+    /// final partition for elements not reachable from any root (members of
+    /// ownership cycles, or children of dangling owners). Every element
+    /// appears in exactly one partition.
+    fn ownership_partitions(&self) -> Vec<Vec<&Element>> {
+        let mut partitions: Vec<Vec<&Element>> = Vec::new();
+        let mut visited: HashSet<&ElementId> = HashSet::with_capacity(self.elements.len());
+
+        for root in self.roots() {
+            let mut partition = Vec::new();
+            let mut stack = vec![root];
+            while let Some(element) = stack.pop() {
+                if !visited.insert(&element.id) {
+                    continue;
+                }
+                partition.push(element);
+                stack.extend(self.children_of(&element.id));
+            }
+            partitions.push(partition);
+        }
+
+        // Elements not reachable from any root end up in a remainder
+        // partition so per-element checks still cover them.
+        let rest: Vec<&Element> = self
+            .elements
+            .values()
+            .filter(|e| !visited.contains(&e.id))
+            .collect();
+        if !rest.is_empty() {
+            partitions.push(rest);
+        }
+
+        partitions
+    }
+
+    /// Run all per-element checks for one element.
+    fn check_element(&self, element: &Element, errors: &mut Vec<StructuralError>) {
+        self.check_orphan(element, errors);
+        self.check_membership_references(element, errors);
+        self.check_owning_membership_reference(element, errors);
+    }
+
     /// Check for orphan elements and return errors.
     fn collect_orphan_errors(&self) -> Vec<StructuralError> {
-        self.elements
-            .iter()
-            .filter(|(_, element)| {
-                element.owner.is_none()
-                    && element.owning_membership.is_none()
-                    && !is_valid_root_kind(&element.kind)
-            })
-            .map(|(id, element)| StructuralError::OrphanElement {
-                element_id: id.clone(),
+        let mut errors = Vec::new();
+        for element in self.elements.values() {
+            self.check_orphan(element, &mut errors);
+        }
+        errors
+    }
+
+    /// Per-element orphan check.
+    fn check_orphan(&self, element: &Element, errors: &mut Vec<StructuralError>) {
+        if element.owner.is_none()
+            && element.owning_membership.is_none()
+            && !is_valid_root_kind(&element.kind)
+        {
+            errors.push(StructuralError::OrphanElement {
+                element_id: element.id.clone(),
                 element_name: element.name.clone(),
                 element_kind: element.kind.clone(),
-            })
-            .collect()
+            });
+        }
     }
 
     /// Check for ownership cycles and return errors.
@@ -653,75 +717,89 @@ impl ModelGraph {
     /// Validate membership element references and return errors.
     fn collect_membership_reference_errors(&self) -> Vec<StructuralError> {
         let mut errors = Vec::new();
-        for (id, element) in &self.elements {
-            // Only check Membership elements
-            if element.kind != ElementKind::Membership
-                && !element.kind.is_subtype_of(ElementKind::Membership)
-            {
-                continue;
-            }
+        for element in self.elements.values() {
+            self.check_membership_references(element, &mut errors);
+        }
+        errors
+    }
 
-            // Check memberElement reference
-            if let Some(member_ref) = element.props.get(membership_props::MEMBER_ELEMENT) {
-                if let Some(member_id) = member_ref.as_ref() {
-                    if !self.elements.contains_key(member_id) {
-                        errors.push(StructuralError::DanglingMembershipRef {
-                            membership_id: id.clone(),
-                            property: membership_props::MEMBER_ELEMENT.to_string(),
-                            missing_id: member_id.clone(),
-                        });
-                    }
+    /// Per-element membership reference check.
+    fn check_membership_references(&self, element: &Element, errors: &mut Vec<StructuralError>) {
+        // Only check Membership elements
+        if element.kind != ElementKind::Membership
+            && !element.kind.is_subtype_of(ElementKind::Membership)
+        {
+            return;
+        }
+
+        // Check memberElement reference
+        if let Some(member_ref) = element.props.get(membership_props::MEMBER_ELEMENT) {
+            if let Some(member_id) = member_ref.as_ref() {
+                if !self.elements.contains_key(member_id) {
+                    errors.push(StructuralError::DanglingMembershipRef {
+                        membership_id: element.id.clone(),
+                        property: membership_props::MEMBER_ELEMENT.to_string(),
+                        missing_id: member_id.clone(),
+                    });
                 }
             }
+        }
 
-            // Check membershipOwningNamespace reference
-            if let Some(ns_ref) = element
-                .props
-                .get(membership_props::MEMBERSHIP_OWNING_NAMESPACE)
-            {
-                if let Some(ns_id) = ns_ref.as_ref() {
-                    if !self.elements.contains_key(ns_id) {
-                        errors.push(StructuralError::DanglingMembershipRef {
-                            membership_id: id.clone(),
-                            property: membership_props::MEMBERSHIP_OWNING_NAMESPACE.to_string(),
-                            missing_id: ns_id.clone(),
-                        });
-                    }
+        // Check membershipOwningNamespace reference
+        if let Some(ns_ref) = element
+            .props
+            .get(membership_props::MEMBERSHIP_OWNING_NAMESPACE)
+        {
+            if let Some(ns_id) = ns_ref.as_ref() {
+                if !self.elements.contains_key(ns_id) {
+                    errors.push(StructuralError::DanglingMembershipRef {
+                        membership_id: element.id.clone(),
+                        property: membership_props::MEMBERSHIP_OWNING_NAMESPACE.to_string(),
+                        missing_id: ns_id.clone(),
+                    });
                 }
             }
         }
-        errors
     }
 
     /// Validate owning_membership references in elements and return errors.
     fn collect_owning_membership_reference_errors(&self) -> Vec<StructuralError> {
         let mut errors = Vec::new();
-        for (id, element) in &self.elements {
-            if let Some(membership_id) = &element.owning_membership {
-                match self.elements.get(membership_id) {
-                    None => {
-                        errors.push(StructuralError::DanglingOwningMembership {
-                            element_id: id.clone(),
-                            element_name: element.name.clone(),
-                            missing_membership_id: membership_id.clone(),
+        for element in self.elements.values() {
+            self.check_owning_membership_reference(element, &mut errors);
+        }
+        errors
+    }
+
+    /// Per-element owning_membership reference check.
+    fn check_owning_membership_reference(
+        &self,
+        element: &Element,
+        errors: &mut Vec<StructuralError>,
+    ) {
+        if let Some(membership_id) = &element.owning_membership {
+            match self.elements.get(membership_id) {
+                None => {
+                    errors.push(StructuralError::DanglingOwningMembership {
+                        element_id: element.id.clone(),
+                        element_name: element.name.clone(),
+                        missing_membership_id: membership_id.clone(),
+                    });
+                }
+                Some(membership) => {
+                    // Check it's actually a Membership
+                    if membership.kind != ElementKind::Membership
+                        && !membership.kind.is_subtype_of(ElementKind::Membership)
+                    {
+                        errors.push(StructuralError::InvalidOwningMembership {
+                            element_id: element.id.clone(),
+                            membership_id: membership_id.clone(),
+                            membership_kind: membership.kind.clone(),
                         });
                     }
-                    Some(membership) => {
-                        // Check it's actually a Membership
-                        if membership.kind != ElementKind::Membership
-                            && !membership.kind.is_subtype_of(ElementKind::Membership)
-                        {
-                            errors.push(StructuralError::InvalidOwningMembership {
-                                element_id: id.clone(),
-                                membership_id: membership_id.clone(),
-                                membership_kind: membership.kind.clone(),
-                            });
-                        }
-                    }
                 }
             }
         }
-        errors
     }
 
     /// Validate relationship source/target references and return errors.
@@ -1359,4 +1437,78 @@ mod tests {
             assert!(diag.is_error());
         }
     }
+
+    #[test]
+    fn ownership_partitions_cover_all_elements() {
+        let mut graph = ModelGraph::new();
+
+        // Two root subtrees plus one orphan not reachable from any root.
+        let pkg_a = graph.add_element(Element::new_with_kind(ElementKind::Package).with_name("A"));
+        let pkg_b = graph.add_element(Element::new_with_kind(ElementKind::Package).with_name("B"));
+        for i in 0..3 {
+            let part = Element::new_with_kind(ElementKind::PartUsage)
+                .with_name(format!("a{}", i))
+                .with_owner(pkg_a.clone());
+            graph.add_element(part);
+        }
+        let part_b = Element::new_with_kind(ElementKind::PartUsage)
+            .with_name("b0")
+            .with_owner(pkg_b.clone());
+        graph.add_element(part_b);
+        // Child of a dangling owner: lands in the remainder partition.
+        let dangling = Element::new_with_kind(ElementKind::PartUsage)
+            .with_name("stray")
+            .with_owner(ElementId::new_v4());
+        graph.add_element(dangling);
+
+        let partitions = graph.ownership_partitions();
+        let total: usize = partitions.iter().map(|p| p.len()).sum();
+        assert_eq!(total, graph.element_count(), "every element in exactly one partition");
+
+        let mut seen = HashSet::new();
+        for partition in &partitions {
+            for element in partition {
+                assert!(seen.insert(element.id.clone()), "no element in two partitions");
+            }
+        }
+    }
+
+    #[test]
+    fn parallel_validation_matches_sequential_and_is_deterministic() {
+        // Build a graph large enough to take the parallel path, with a mix
+        // of valid subtrees and deliberate defects.
+        let mut graph = ModelGraph::new();
+        for r in 0..8 {
+            let root = graph.add_element(
+                Element::new_with_kind(ElementKind::Package).with_name(format!("Root{}", r)),
+            );
+            for i in 0..700 {
+                let part = Element::new_with_kind(ElementKind::PartUsage)
+                    .with_name(format!("p{}_{}", r, i))
+                    .with_owner(root.clone());
+                graph.add_element(part);
+            }
+        }
+        // Defects: an orphan and a dangling owning_membership.
+        graph.add_element(Element::new_with_kind(ElementKind::PartDefinition).with_name("orphan"));
+        graph.add_element(
+            Element::new_with_kind(ElementKind::PartUsage)
+                .with_name("dangling")
+                .with_owning_membership(ElementId::new_v4()),
+        );
+
+        assert!(graph.element_count() > 5000, "must exercise the parallel path");
+
+        let parallel = graph.validate_structure_parallel();
+        let sequential = graph.validate_structure_sequential();
+        assert_eq!(parallel.len(), sequential.len());
+        // Same error multiset (ordering differs between the two paths).
+        for error in &sequential {
+            assert!(parallel.contains(error), "missing error: {:?}", error);
+        }
+
+        // The parallel path itself is deterministic run-to-run.
+        let again = graph.validate_structure_parallel();
+        assert_eq!(parallel, again);
+    }
 }
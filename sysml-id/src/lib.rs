@@ -86,6 +86,7 @@ impl std::error::Error for IdError {}
 /// assert_eq!(id, parsed);
 /// ```
 #[derive(Debug, Clone, PartialEq, Eq, PartialOrd, Ord, Hash)]
+#[cfg_attr(feature = "uuid", derive(Copy))]
 #[cfg_attr(feature = "serde", derive(Serialize, Deserialize))]
 #[cfg_attr(feature = "serde", serde(transparent))]
 pub struct ElementId(
@@ -93,6 +94,14 @@ pub struct ElementId(
     #[cfg(not(feature = "uuid"))] String,
 );
 
+// IDs flow through every graph index; keep them a plain 16-byte value.
+#[cfg(feature = "uuid")]
+const _: () = assert!(std::mem::size_of::<ElementId>() == 16);
+
+/// Length of the hyphenated string form of an [`ElementId`].
+#[cfg(feature = "uuid")]
+pub const ID_STR_LEN: usize = 36;
+
 impl ElementId {
     /// Create a new random ElementId (UUID v4 when uuid feature enabled).
     ///
@@ -202,14 +211,152 @@ impl ElementId {
             self.0.clone()
         }
     }
+
+    /// Render this ID into a caller-provided buffer, without allocating.
+    ///
+    /// Serialization paths that emit many IDs should reuse one buffer
+    /// instead of calling [`ElementId::as_str`] per ID.
+    ///
+    /// # Examples
+    ///
+    /// ```
+    /// use sysml_id::{ElementId, ID_STR_LEN};
+    ///
+    /// let id = ElementId::new_v4();
+    /// let mut buf = [0u8; ID_STR_LEN];
+    /// assert_eq!(id.encode_str(&mut buf), id.as_str());
+    /// ```
+    #[cfg(feature = "uuid")]
+    pub fn encode_str<'buf>(&self, buf: &'buf mut [u8; ID_STR_LEN]) -> &'buf str {
+        self.0.hyphenated().encode_lower(buf)
+    }
 }
 
 impl fmt::Display for ElementId {
     fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
-        write!(f, "{}", self.as_str())
+        #[cfg(feature = "uuid")]
+        {
+            let mut buf = [0u8; ID_STR_LEN];
+            f.write_str(self.encode_str(&mut buf))
+        }
+        #[cfg(not(feature = "uuid"))]
+        {
+            write!(f, "{}", self.0)
+        }
+    }
+}
+
+/// A hasher specialized for [`ElementId`] keys.
+///
+/// ID bytes are already uniformly distributed (UUID v4 entropy, or the
+/// mixing in [`ElementId::from_string`]), so hashing only needs to fold
+/// them into a `u64` — no avalanche rounds like a general-purpose hasher.
+/// Use via [`IdMap`] / [`IdSet`].
+#[derive(Debug, Default, Clone, Copy)]
+pub struct IdHasher(u64);
+
+impl std::hash::Hasher for IdHasher {
+    fn finish(&self) -> u64 {
+        self.0
+    }
+
+    fn write(&mut self, bytes: &[u8]) {
+        let mut word = [0u8; 8];
+        for chunk in bytes.chunks(8) {
+            word[..chunk.len()].copy_from_slice(chunk);
+            self.0 ^= u64::from_le_bytes(word);
+        }
+    }
+}
+
+/// Builds [`IdHasher`]s; the hasher is stateless so this is a unit type.
+pub type BuildIdHasher = std::hash::BuildHasherDefault<IdHasher>;
+
+/// A hash map keyed by [`ElementId`], using the specialized [`IdHasher`].
+pub type IdMap<V> = std::collections::HashMap<ElementId, V, BuildIdHasher>;
+
+/// A hash set of [`ElementId`]s, using the specialized [`IdHasher`].
+pub type IdSet = std::collections::HashSet<ElementId, BuildIdHasher>;
+
+/// Generates [`ElementId`]s from a single entropy draw.
+///
+/// [`ElementId::new_v4`] takes fresh entropy per call, which shows up as
+/// `getrandom` syscalls when creating thousands of elements. A generator
+/// seeds once and derives each subsequent ID by mixing a counter through
+/// SplitMix64, so IDs stay unique and uniformly distributed while bulk
+/// loads pay for entropy once.
+///
+/// # Examples
+///
+/// ```
+/// use sysml_id::IdGenerator;
+///
+/// let mut ids = IdGenerator::new();
+/// let a = ids.next_id();
+/// let b = ids.next_id();
+/// assert_ne!(a, b);
+/// ```
+#[cfg(feature = "uuid")]
+#[derive(Debug, Clone)]
+pub struct IdGenerator {
+    hi: u64,
+    lo: u64,
+    counter: u64,
+}
+
+#[cfg(feature = "uuid")]
+impl IdGenerator {
+    /// Create a generator seeded from one random UUID.
+    pub fn new() -> Self {
+        let seed = uuid::Uuid::new_v4().into_bytes();
+        IdGenerator {
+            hi: u64::from_le_bytes(seed[..8].try_into().expect("8-byte slice")),
+            lo: u64::from_le_bytes(seed[8..].try_into().expect("8-byte slice")),
+            counter: 0,
+        }
+    }
+
+    /// Generate the next ID.
+    pub fn next_id(&mut self) -> ElementId {
+        self.counter += 1;
+        let hi = splitmix64(self.hi ^ self.counter);
+        let lo = splitmix64(self.lo.wrapping_add(self.counter));
+
+        let mut bytes = [0u8; 16];
+        bytes[..8].copy_from_slice(&hi.to_le_bytes());
+        bytes[8..].copy_from_slice(&lo.to_le_bytes());
+        // Keep the version/variant bits of a v4 UUID.
+        bytes[6] = (bytes[6] & 0x0f) | 0x40;
+        bytes[8] = (bytes[8] & 0x3f) | 0x80;
+        ElementId(uuid::Uuid::from_bytes(bytes))
+    }
+}
+
+#[cfg(feature = "uuid")]
+impl Default for IdGenerator {
+    fn default() -> Self {
+        Self::new()
     }
 }
 
+#[cfg(feature = "uuid")]
+impl Iterator for IdGenerator {
+    type Item = ElementId;
+
+    fn next(&mut self) -> Option<ElementId> {
+        Some(self.next_id())
+    }
+}
+
+/// SplitMix64 finalizer: a full-avalanche mix of a 64-bit value.
+#[cfg(feature = "uuid")]
+fn splitmix64(mut x: u64) -> u64 {
+    x = x.wrapping_add(0x9e3779b97f4a7c15);
+    x = (x ^ (x >> 30)).wrapping_mul(0xbf58476d1ce4e5b9);
+    x = (x ^ (x >> 27)).wrapping_mul(0x94d049bb133111eb);
+    x ^ (x >> 31)
+}
+
 impl FromStr for ElementId {
     type Err = IdError;
 
@@ -714,6 +861,50 @@ mod tests {
         assert_eq!(id1, id2);
     }
 
+    #[cfg(feature = "uuid")]
+    #[test]
+    fn element_id_is_copy() {
+        fn assert_copy<T: Copy>() {}
+        assert_copy::<ElementId>();
+        assert_eq!(std::mem::size_of::<ElementId>(), 16);
+    }
+
+    #[cfg(feature = "uuid")]
+    #[test]
+    fn encode_str_matches_as_str() {
+        let id = ElementId::new_v4();
+        let mut buf = [0u8; ID_STR_LEN];
+        assert_eq!(id.encode_str(&mut buf), id.as_str());
+        assert_eq!(id.to_string(), id.as_str());
+    }
+
+    #[test]
+    fn id_map_stores_and_finds_keys() {
+        let mut map: IdMap<u32> = IdMap::default();
+        let ids: Vec<ElementId> = (0..100).map(|i| ElementId::from_string(format!("e{}", i))).collect();
+        for (i, id) in ids.iter().enumerate() {
+            map.insert(id.clone(), i as u32);
+        }
+        assert_eq!(map.len(), 100);
+        for (i, id) in ids.iter().enumerate() {
+            assert_eq!(map.get(id), Some(&(i as u32)));
+        }
+    }
+
+    #[cfg(feature = "uuid")]
+    #[test]
+    fn id_generator_yields_unique_v4_ids() {
+        let mut generator = IdGenerator::new();
+        let ids: IdSet = (&mut generator).take(10_000).collect();
+        assert_eq!(ids.len(), 10_000);
+
+        let id = generator.next_id();
+        let s = id.as_str();
+        // Version and variant positions of the hyphenated form.
+        assert_eq!(&s[14..15], "4");
+        assert!(matches!(&s[19..20], "8" | "9" | "a" | "b"));
+    }
+
     #[test]
     fn project_id_roundtrip() {
         let id = ProjectId::new("my-project");
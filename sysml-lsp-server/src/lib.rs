@@ -19,10 +19,14 @@ use sysml_lsp::{DiagnosticSeverity as SysmlSeverity, LspDiagnostic, Range as Lsp
 use sysml_text::library::{load_standard_library, LibraryConfig};
 use sysml_text::{Parser as SysmlParser, SysmlFile as TextFile};
 use sysml_text_pest::PestParser;
-use sysml_ts::{extract_outline, FastParser, StubTreeSitterParser, SysmlFile as TsFile};
+use sysml_ts::{extract_outline_compact, SysmlFile as TsFile, TreeSitterParser};
 
 use sysml_core::ModelGraph;
-use sysml_span::Diagnostic as SysmlDiagnostic;
+use sysml_span::{Diagnostic as SysmlDiagnostic, LineIndex};
+
+/// How long to wait after the last edit before analyzing, so rapid typing
+/// coalesces into a single parse/resolve pass.
+const ANALYSIS_DEBOUNCE_MS: u64 = 250;
 
 /// Document state.
 #[derive(Debug, Clone)]
@@ -33,6 +37,60 @@ struct Document {
     content: String,
     /// The document version.
     version: i32,
+    /// Line-offset index, patched incrementally by range edits.
+    line_index: LineIndex,
+}
+
+impl Document {
+    fn new(uri: String, content: String, version: i32) -> Self {
+        let line_index = LineIndex::new(&content);
+        Document {
+            uri,
+            content,
+            version,
+            line_index,
+        }
+    }
+}
+
+/// Convert an LSP position (0-indexed line, UTF-16 character) to a byte offset.
+fn position_to_offset(index: &LineIndex, content: &str, position: Position) -> usize {
+    let line_start = match index.line_start(position.line + 1) {
+        Some(offset) => offset,
+        None => return content.len(),
+    };
+    let line_end = index
+        .line_start(position.line + 2)
+        .unwrap_or(content.len());
+
+    let mut utf16_units = 0;
+    for (i, c) in content[line_start..line_end].char_indices() {
+        if utf16_units >= position.character as usize {
+            return line_start + i;
+        }
+        utf16_units += c.len_utf16();
+    }
+    line_end
+}
+
+/// Apply one LSP content change to a document buffer.
+///
+/// Range edits splice the buffer and patch the line index in place; a
+/// change without a range is a full-text replacement.
+fn apply_content_change(document: &mut Document, change: &TextDocumentContentChangeEvent) {
+    match change.range {
+        Some(range) => {
+            let start = position_to_offset(&document.line_index, &document.content, range.start);
+            let end = position_to_offset(&document.line_index, &document.content, range.end);
+            let (start, end) = (start.min(end), start.max(end).min(document.content.len()));
+            document.line_index.edit(start, end, &change.text);
+            document.content.replace_range(start..end, &change.text);
+        }
+        None => {
+            document.content = change.text.clone();
+            document.line_index = LineIndex::new(&document.content);
+        }
+    }
 }
 
 #[derive(Debug, Clone)]
@@ -49,11 +107,13 @@ pub struct SysmlLanguageServer {
     /// Open documents.
     documents: Arc<RwLock<HashMap<String, Document>>>,
     /// The CST parser.
-    cst_parser: StubTreeSitterParser,
-    /// The semantic parser (sysml-text-pest).
-    semantic_parser: PestParser,
+    cst_parser: TreeSitterParser,
+    /// The semantic parser (sysml-text-pest), shared with analysis tasks.
+    semantic_parser: Arc<PestParser>,
     /// Standard library cache.
     library_state: Arc<RwLock<LibraryState>>,
+    /// In-flight background analysis per document, aborted when superseded.
+    analysis_tasks: Arc<RwLock<HashMap<String, tokio::task::JoinHandle<()>>>>,
 }
 
 impl SysmlLanguageServer {
@@ -62,92 +122,139 @@ impl SysmlLanguageServer {
         SysmlLanguageServer {
             client,
             documents: Arc::new(RwLock::new(HashMap::new())),
-            cst_parser: StubTreeSitterParser::new(),
-            semantic_parser: PestParser::new(),
+            cst_parser: TreeSitterParser::new(),
+            semantic_parser: Arc::new(PestParser::new()),
             library_state: Arc::new(RwLock::new(LibraryState::Unloaded)),
+            analysis_tasks: Arc::new(RwLock::new(HashMap::new())),
         }
     }
 
-    /// Publish diagnostics for a document.
-    async fn publish_diagnostics(&self, uri: &str, content: &str) {
-        let file = TextFile::new(uri, content);
-        let mut result = self.semantic_parser.parse(&[file]);
-
-        let parse_ok = result.error_count() == 0;
-        let mut sysml_diags = result.diagnostics.clone();
-
-        if parse_ok {
-            let library = self.load_library_if_needed().await;
-            let resolution = if let Some(lib) = library {
-                result.resolve_with_library(lib)
-            } else {
-                result.resolve()
-            };
-            sysml_diags.extend(resolution.diagnostics.into_iter());
-
-            const ENABLE_VALIDATION: bool = true;
-            if ENABLE_VALIDATION {
-                let base_len = result.diagnostics.len();
-                result.validate_structure();
-                result.validate_relationships();
-                sysml_diags.extend(result.diagnostics.iter().skip(base_len).cloned());
+    /// Schedule parse/resolve for a document on a background task.
+    ///
+    /// Any analysis still pending or running for the same document is
+    /// aborted first, so rapid edits never queue redundant work; with
+    /// `debounce` the task waits [`ANALYSIS_DEBOUNCE_MS`] before starting,
+    /// giving the next keystroke a chance to cancel it cheaply.
+    async fn schedule_analysis(&self, uri: String, content: String, debounce: bool) {
+        let client = self.client.clone();
+        let parser = Arc::clone(&self.semantic_parser);
+        let library_state = Arc::clone(&self.library_state);
+
+        let task_uri = uri.clone();
+        let handle = tokio::spawn(async move {
+            if debounce {
+                tokio::time::sleep(tokio::time::Duration::from_millis(ANALYSIS_DEBOUNCE_MS)).await;
             }
-        }
-
-        let diagnostics: Vec<Diagnostic> = sysml_diags
-            .iter()
-            .map(|diag| to_lsp_diagnostic(diag, content))
-            .collect();
+            analyze_and_publish(client, parser, library_state, task_uri, content).await;
+        });
 
-        self.client
-            .publish_diagnostics(
-                Url::parse(uri).unwrap_or_else(|_| Url::parse("file:///unknown").unwrap()),
-                diagnostics,
-                None,
-            )
-            .await;
+        let mut tasks = self.analysis_tasks.write().await;
+        if let Some(stale) = tasks.insert(uri, handle) {
+            stale.abort();
+        }
     }
 
-    async fn load_library_if_needed(&self) -> Option<ModelGraph> {
-        {
-            let state = self.library_state.read().await;
-            match &*state {
-                LibraryState::Loaded(lib) => return Some(lib.clone()),
-                LibraryState::Failed(_) => return None,
-                LibraryState::Unloaded => {}
-            }
+    /// Abort any pending analysis for a closed document.
+    async fn cancel_analysis(&self, uri: &str) {
+        if let Some(stale) = self.analysis_tasks.write().await.remove(uri) {
+            stale.abort();
         }
+    }
+}
 
-        let config = match LibraryConfig::from_env_optional() {
-            Some(config) => config,
-            None => {
-                let mut state = self.library_state.write().await;
-                *state = LibraryState::Failed(
-                    "Standard library not configured (SYSML_LIBRARY_PATH not set and default not found)".to_string(),
-                );
-                return None;
-            }
+/// Parse, resolve, validate, and publish diagnostics for one document.
+///
+/// Runs on a background task so the notification handlers return
+/// immediately; the owning task handle is aborted when a newer edit
+/// supersedes this analysis.
+async fn analyze_and_publish(
+    client: Client,
+    parser: Arc<PestParser>,
+    library_state: Arc<RwLock<LibraryState>>,
+    uri: String,
+    content: String,
+) {
+    let file = TextFile::new(&uri, &content);
+    let mut result = parser.parse(&[file]);
+
+    let parse_ok = result.error_count() == 0;
+    let mut sysml_diags = result.diagnostics.clone();
+
+    if parse_ok {
+        let library = load_library_if_needed(&client, &parser, &library_state).await;
+        let resolution = if let Some(lib) = library {
+            result.resolve_with_library(lib)
+        } else {
+            result.resolve()
         };
+        sysml_diags.extend(resolution.diagnostics.into_iter());
+
+        const ENABLE_VALIDATION: bool = true;
+        if ENABLE_VALIDATION {
+            let base_len = result.diagnostics.len();
+            result.validate_structure();
+            result.validate_relationships();
+            sysml_diags.extend(result.diagnostics.iter().skip(base_len).cloned());
+        }
+    }
 
-        match load_standard_library(&self.semantic_parser, &config) {
-            Ok(library) => {
-                let mut state = self.library_state.write().await;
-                *state = LibraryState::Loaded(library.clone());
-                self.client
-                    .log_message(
-                        MessageType::INFO,
-                        "Loaded SysML standard library for resolution",
-                    )
-                    .await;
-                Some(library)
-            }
-            Err(err) => {
-                let message = format!("Failed to load standard library: {}", err);
-                let mut state = self.library_state.write().await;
-                *state = LibraryState::Failed(message.clone());
-                self.client.log_message(MessageType::ERROR, message).await;
-                None
-            }
+    let diagnostics: Vec<Diagnostic> = sysml_diags
+        .iter()
+        .map(|diag| to_lsp_diagnostic(diag, &content))
+        .collect();
+
+    client
+        .publish_diagnostics(
+            Url::parse(&uri).unwrap_or_else(|_| Url::parse("file:///unknown").unwrap()),
+            diagnostics,
+            None,
+        )
+        .await;
+}
+
+async fn load_library_if_needed(
+    client: &Client,
+    parser: &PestParser,
+    library_state: &RwLock<LibraryState>,
+) -> Option<ModelGraph> {
+    {
+        let state = library_state.read().await;
+        match &*state {
+            LibraryState::Loaded(lib) => return Some(lib.clone()),
+            LibraryState::Failed(_) => return None,
+            LibraryState::Unloaded => {}
+        }
+    }
+
+    let config = match LibraryConfig::from_env_optional() {
+        Some(config) => config,
+        None => {
+            let mut state = library_state.write().await;
+            *state = LibraryState::Failed(
+                "Standard library not configured (SYSML_LIBRARY_PATH not set and default not found)".to_string(),
+            );
+            return None;
+        }
+    };
+
+    match load_standard_library(parser, &config) {
+        Ok(library) => {
+            let mut state = library_state.write().await;
+            *state = LibraryState::Loaded(library.clone());
+            client
+                .log_message(
+                    MessageType::INFO,
+                    "Loaded SysML standard library for resolution",
+                )
+                .await;
+            Some(library)
+        }
+        Err(err) => {
+            let message = format!("Failed to load standard library: {}", err);
+            let mut state = library_state.write().await;
+            *state = LibraryState::Failed(message.clone());
+            client.log_message(MessageType::ERROR, message).await;
+            None
         }
     }
 }
@@ -218,7 +325,7 @@ impl LanguageServer for SysmlLanguageServer {
         Ok(InitializeResult {
             capabilities: ServerCapabilities {
                 text_document_sync: Some(TextDocumentSyncCapability::Kind(
-                    TextDocumentSyncKind::FULL,
+                    TextDocumentSyncKind::INCREMENTAL,
                 )),
                 document_symbol_provider: Some(OneOf::Left(true)),
                 ..Default::default()
@@ -247,45 +354,35 @@ impl LanguageServer for SysmlLanguageServer {
 
         {
             let mut docs = self.documents.write().await;
-            docs.insert(
-                uri.clone(),
-                Document {
-                    uri: uri.clone(),
-                    content: content.clone(),
-                    version,
-                },
-            );
+            docs.insert(uri.clone(), Document::new(uri.clone(), content.clone(), version));
         }
 
-        self.publish_diagnostics(&uri, &content).await;
+        // Analyze a freshly opened document right away.
+        self.schedule_analysis(uri, content, false).await;
     }
 
     async fn did_change(&self, params: DidChangeTextDocumentParams) {
         let uri = params.text_document.uri.to_string();
         let version = params.text_document.version;
 
-        // Full sync - take the last change
-        if let Some(change) = params.content_changes.into_iter().last() {
-            let content = change.text;
-
-            {
-                let mut docs = self.documents.write().await;
-                docs.insert(
-                    uri.clone(),
-                    Document {
-                        uri: uri.clone(),
-                        content: content.clone(),
-                        version,
-                    },
-                );
+        let content = {
+            let mut docs = self.documents.write().await;
+            let document = docs
+                .entry(uri.clone())
+                .or_insert_with(|| Document::new(uri.clone(), String::new(), version));
+            for change in &params.content_changes {
+                apply_content_change(document, change);
             }
+            document.version = version;
+            document.content.clone()
+        };
 
-            self.publish_diagnostics(&uri, &content).await;
-        }
+        self.schedule_analysis(uri, content, true).await;
     }
 
     async fn did_close(&self, params: DidCloseTextDocumentParams) {
         let uri = params.text_document.uri.to_string();
+        self.cancel_analysis(&uri).await;
         let mut docs = self.documents.write().await;
         docs.remove(&uri);
     }
@@ -303,8 +400,8 @@ impl LanguageServer for SysmlLanguageServer {
         };
 
         let file = TsFile::new(&uri, &doc.content);
-        let cst = self.cst_parser.parse_cst(&file);
-        let outline = extract_outline(&cst, &doc.content);
+        let cst = self.cst_parser.parse_compact(&file);
+        let outline = extract_outline_compact(&cst, &doc.content);
 
         let symbols: Vec<DocumentSymbol> = outline
             .into_iter()
@@ -368,4 +465,84 @@ mod tests {
         let (_service, _socket) = create_service();
         // Just verify it compiles and creates without panic
     }
+
+    fn change(
+        start: (u32, u32),
+        end: (u32, u32),
+        text: &str,
+    ) -> TextDocumentContentChangeEvent {
+        TextDocumentContentChangeEvent {
+            range: Some(Range {
+                start: Position {
+                    line: start.0,
+                    character: start.1,
+                },
+                end: Position {
+                    line: end.0,
+                    character: end.1,
+                },
+            }),
+            range_length: None,
+            text: text.to_string(),
+        }
+    }
+
+    #[test]
+    fn incremental_change_patches_buffer_and_index() {
+        let mut doc = Document::new(
+            "file:///test.sysml".to_string(),
+            "package P {\n    part a;\n}\n".to_string(),
+            1,
+        );
+
+        // Rename "a" to "axle" via a range edit.
+        apply_content_change(&mut doc, &change((1, 9), (1, 10), "axle"));
+        assert_eq!(doc.content, "package P {\n    part axle;\n}\n");
+
+        // Insert a new line.
+        apply_content_change(&mut doc, &change((1, 14), (1, 14), "\n    part b;"));
+        assert_eq!(doc.content, "package P {\n    part axle;\n    part b;\n}\n");
+
+        // The patched index matches a fresh scan.
+        assert_eq!(
+            doc.line_index.line_count(),
+            LineIndex::new(&doc.content).line_count()
+        );
+        assert_eq!(doc.line_index.line_start(3), Some(27));
+    }
+
+    #[test]
+    fn full_change_replaces_buffer() {
+        let mut doc = Document::new("file:///test.sysml".to_string(), "old".to_string(), 1);
+        apply_content_change(
+            &mut doc,
+            &TextDocumentContentChangeEvent {
+                range: None,
+                range_length: None,
+                text: "package New {\n}\n".to_string(),
+            },
+        );
+        assert_eq!(doc.content, "package New {\n}\n");
+        assert_eq!(doc.line_index.line_count(), 3);
+    }
+
+    #[test]
+    fn position_to_offset_clamps_and_counts_utf16() {
+        let content = "ab\ncé Ω\n";
+        let index = LineIndex::new(content);
+
+        assert_eq!(position_to_offset(&index, content, Position::new(0, 0)), 0);
+        assert_eq!(position_to_offset(&index, content, Position::new(1, 0)), 3);
+        // 'é' is one UTF-16 unit but two bytes.
+        assert_eq!(position_to_offset(&index, content, Position::new(1, 2)), 6);
+        // Past end of line clamps to the line end; past last line to EOF.
+        assert_eq!(
+            position_to_offset(&index, content, Position::new(0, 99)),
+            3
+        );
+        assert_eq!(
+            position_to_offset(&index, content, Position::new(9, 0)),
+            content.len()
+        );
+    }
 }
@@ -165,6 +165,232 @@ pub fn requirements_satisfied_by<'a>(
         .filter_map(move |r| graph.get_element(&r.target))
 }
 
+/// A single traced relationship in a [`TraceIndex`].
+#[derive(Debug, Clone)]
+pub struct TraceEntry {
+    /// The source element (the satisfying/verifying/tracing side).
+    pub source: ElementId,
+    /// The target element (typically a requirement).
+    pub target: ElementId,
+    /// The relationship id.
+    pub relationship: ElementId,
+}
+
+/// Per-kind portion of a [`TraceIndex`].
+///
+/// Entries are keyed by relationship id (keeping iteration deterministic,
+/// like `ModelGraph` itself) with a target-keyed lookup index on the side.
+#[derive(Debug, Clone, Default)]
+struct TraceKindIndex {
+    /// All traced relationships of this kind, keyed by relationship id.
+    entries: std::collections::BTreeMap<ElementId, TraceEntry>,
+    /// Target element -> relationship ids targeting it.
+    by_target: std::collections::HashMap<ElementId, Vec<ElementId>>,
+}
+
+impl TraceKindIndex {
+    fn insert(&mut self, rel: &Relationship) {
+        self.entries.insert(
+            rel.id.clone(),
+            TraceEntry {
+                source: rel.source.clone(),
+                target: rel.target.clone(),
+                relationship: rel.id.clone(),
+            },
+        );
+        self.by_target
+            .entry(rel.target.clone())
+            .or_default()
+            .push(rel.id.clone());
+    }
+
+    fn remove(&mut self, relationship_id: &ElementId) -> bool {
+        match self.entries.remove(relationship_id) {
+            Some(entry) => {
+                if let Some(ids) = self.by_target.get_mut(&entry.target) {
+                    ids.retain(|id| id != relationship_id);
+                    if ids.is_empty() {
+                        self.by_target.remove(&entry.target);
+                    }
+                }
+                true
+            }
+            None => false,
+        }
+    }
+
+    fn entries_for_target(&self, target: &ElementId) -> impl Iterator<Item = &TraceEntry> {
+        self.by_target
+            .get(target)
+            .into_iter()
+            .flatten()
+            .filter_map(|id| self.entries.get(id))
+    }
+}
+
+/// Precomputed index over requirement-tracing relationships.
+///
+/// `trace_matrix` and the `elements_satisfying`/`elements_verifying` helpers
+/// scan relationships for every query; regenerating a compliance matrix that
+/// way is O(requirements × relationships). A `TraceIndex` is built once per
+/// graph and answers the same questions with O(1) lookups per requirement.
+///
+/// The index covers the relationship kinds used for requirement tracing in
+/// this model: `Satisfy`, `Verify`, `Derive`, and `Trace`. It can be kept in
+/// sync across edits with [`TraceIndex::add_relationship`] and
+/// [`TraceIndex::remove_relationship`] instead of rebuilding.
+///
+/// # Example
+///
+/// ```
+/// use sysml_core::ModelGraph;
+/// use sysml_query::TraceIndex;
+///
+/// let graph = ModelGraph::new();
+/// let index = TraceIndex::build(&graph);
+/// assert_eq!(index.len(), 0);
+/// ```
+#[derive(Debug, Clone, Default)]
+pub struct TraceIndex {
+    satisfy: TraceKindIndex,
+    verify: TraceKindIndex,
+    derive: TraceKindIndex,
+    trace: TraceKindIndex,
+}
+
+impl TraceIndex {
+    /// Build the index from all tracing relationships in a graph.
+    pub fn build(graph: &ModelGraph) -> Self {
+        let mut index = TraceIndex::default();
+        for rel in graph.relationships.values() {
+            index.add_relationship(rel);
+        }
+        index
+    }
+
+    /// The per-kind index for a relationship kind, if it is traced.
+    fn kind_index(&self, kind: &RelationshipKind) -> Option<&TraceKindIndex> {
+        match kind {
+            RelationshipKind::Satisfy => Some(&self.satisfy),
+            RelationshipKind::Verify => Some(&self.verify),
+            RelationshipKind::Derive => Some(&self.derive),
+            RelationshipKind::Trace => Some(&self.trace),
+            _ => None,
+        }
+    }
+
+    fn kind_index_mut(&mut self, kind: &RelationshipKind) -> Option<&mut TraceKindIndex> {
+        match kind {
+            RelationshipKind::Satisfy => Some(&mut self.satisfy),
+            RelationshipKind::Verify => Some(&mut self.verify),
+            RelationshipKind::Derive => Some(&mut self.derive),
+            RelationshipKind::Trace => Some(&mut self.trace),
+            _ => None,
+        }
+    }
+
+    /// Add a relationship to the index. Non-tracing kinds are ignored.
+    pub fn add_relationship(&mut self, rel: &Relationship) {
+        if let Some(index) = self.kind_index_mut(&rel.kind) {
+            index.insert(rel);
+        }
+    }
+
+    /// Remove a relationship from the index by id.
+    ///
+    /// Returns `true` if the relationship was indexed.
+    pub fn remove_relationship(&mut self, relationship_id: &ElementId) -> bool {
+        self.satisfy.remove(relationship_id)
+            || self.verify.remove(relationship_id)
+            || self.derive.remove(relationship_id)
+            || self.trace.remove(relationship_id)
+    }
+
+    /// Total number of indexed relationships.
+    pub fn len(&self) -> usize {
+        self.satisfy.entries.len()
+            + self.verify.entries.len()
+            + self.derive.entries.len()
+            + self.trace.entries.len()
+    }
+
+    /// Check if the index is empty.
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+
+    /// Find elements that satisfy a given requirement (indexed).
+    pub fn elements_satisfying<'a>(
+        &'a self,
+        graph: &'a ModelGraph,
+        requirement_id: &ElementId,
+    ) -> impl Iterator<Item = &'a Element> {
+        self.satisfy
+            .entries_for_target(requirement_id)
+            .filter_map(move |entry| graph.get_element(&entry.source))
+    }
+
+    /// Find elements that verify a given requirement (indexed).
+    pub fn elements_verifying<'a>(
+        &'a self,
+        graph: &'a ModelGraph,
+        requirement_id: &ElementId,
+    ) -> impl Iterator<Item = &'a Element> {
+        self.verify
+            .entries_for_target(requirement_id)
+            .filter_map(move |entry| graph.get_element(&entry.source))
+    }
+
+    /// The trace entries targeting an element for a given relationship kind.
+    ///
+    /// Returns nothing for relationship kinds the index does not cover.
+    pub fn entries_for(&self, kind: &RelationshipKind, target: &ElementId) -> Vec<&TraceEntry> {
+        match self.kind_index(kind) {
+            Some(index) => index.entries_for_target(target).collect(),
+            None => Vec::new(),
+        }
+    }
+
+    /// Generate a trace matrix between two element kinds via a relationship
+    /// kind, using the index instead of scanning relationships.
+    ///
+    /// Produces the same rows (in the same order) as [`trace_matrix`]. For
+    /// relationship kinds the index does not cover, this falls back to the
+    /// scanning implementation.
+    pub fn trace_matrix(
+        &self,
+        graph: &ModelGraph,
+        source_kind: &ElementKind,
+        rel_kind: &RelationshipKind,
+        target_kind: &ElementKind,
+    ) -> Vec<TraceMatrixRow> {
+        let index = match self.kind_index(rel_kind) {
+            Some(index) => index,
+            None => return trace_matrix(graph, source_kind, rel_kind, target_kind),
+        };
+
+        let mut rows = Vec::new();
+        for entry in index.entries.values() {
+            let source = graph.get_element(&entry.source);
+            let target = graph.get_element(&entry.target);
+
+            if let (Some(src), Some(tgt)) = (source, target) {
+                if &src.kind == source_kind && &tgt.kind == target_kind {
+                    rows.push(TraceMatrixRow {
+                        source: src.id.clone(),
+                        source_name: src.name.clone(),
+                        target: tgt.id.clone(),
+                        target_name: tgt.name.clone(),
+                        relationship: entry.relationship.clone(),
+                    });
+                }
+            }
+        }
+
+        rows
+    }
+}
+
 /// Find all ancestors of an element (owner chain).
 pub fn ancestors<'a>(graph: &'a ModelGraph, element_id: &'a ElementId) -> Vec<&'a Element> {
     let mut result = Vec::new();
@@ -201,6 +427,135 @@ pub fn descendants<'a>(graph: &'a ModelGraph, element_id: &'a ElementId) -> Vec<
     result
 }
 
+/// Precomputed reachability index over the ownership forest.
+///
+/// `descendants` re-traverses the ownership tree on every call and
+/// `ancestors` walks owner links one at a time; impact analysis that asks
+/// these questions thousands of times per request pays the traversal cost
+/// each time. An `OwnershipIndex` numbers the forest once in preorder, so
+/// every subtree is a contiguous slice of one array and ancestry is two
+/// integer comparisons.
+///
+/// The index is a snapshot of the ownership forest, built from
+/// `ModelGraph::roots()`/`children_of`. After any ownership change it must
+/// be rebuilt — a single DFS, so rebuilding is far cheaper than one
+/// pre-index impact query.
+///
+/// # Example
+///
+/// ```
+/// use sysml_core::ModelGraph;
+/// use sysml_query::OwnershipIndex;
+///
+/// let graph = ModelGraph::new();
+/// let index = OwnershipIndex::build(&graph);
+/// assert!(index.is_empty());
+/// ```
+#[derive(Debug, Clone, Default)]
+pub struct OwnershipIndex {
+    /// Element ids in DFS preorder over the ownership forest.
+    preorder: Vec<ElementId>,
+    /// Element -> (enter, exit): the subtree rooted at the element is
+    /// `preorder[enter..exit]` (with the element itself at `enter`).
+    intervals: std::collections::HashMap<ElementId, (u32, u32)>,
+}
+
+impl OwnershipIndex {
+    /// Build the index by numbering the ownership forest in preorder.
+    ///
+    /// Elements unreachable from any root (e.g. inside an ownership cycle)
+    /// are numbered as additional roots so every element has an interval.
+    pub fn build(graph: &ModelGraph) -> Self {
+        let mut index = OwnershipIndex {
+            preorder: Vec::with_capacity(graph.element_count()),
+            intervals: std::collections::HashMap::with_capacity(graph.element_count()),
+        };
+
+        let mut visited = std::collections::HashSet::new();
+        for root in graph.roots() {
+            index.number_subtree(graph, &root.id, &mut visited);
+        }
+        // Cover elements not reachable from any root (deterministic order:
+        // graph.elements is a BTreeMap).
+        let remaining: Vec<ElementId> = graph
+            .elements
+            .keys()
+            .filter(|id| !visited.contains(*id))
+            .cloned()
+            .collect();
+        for id in remaining {
+            index.number_subtree(graph, &id, &mut visited);
+        }
+
+        index
+    }
+
+    /// DFS a subtree, assigning preorder positions and intervals.
+    fn number_subtree(
+        &mut self,
+        graph: &ModelGraph,
+        id: &ElementId,
+        visited: &mut std::collections::HashSet<ElementId>,
+    ) {
+        if !visited.insert(id.clone()) {
+            return;
+        }
+        let enter = self.preorder.len() as u32;
+        self.preorder.push(id.clone());
+
+        let children: Vec<ElementId> = graph.children_of(id).map(|c| c.id.clone()).collect();
+        for child in &children {
+            self.number_subtree(graph, child, visited);
+        }
+
+        let exit = self.preorder.len() as u32;
+        self.intervals.insert(id.clone(), (enter, exit));
+    }
+
+    /// The descendants of an element as a contiguous preorder slice.
+    ///
+    /// The element itself is not included. Returns an empty slice for
+    /// unknown elements.
+    pub fn descendants(&self, element_id: &ElementId) -> &[ElementId] {
+        match self.intervals.get(element_id) {
+            Some(&(enter, exit)) => &self.preorder[(enter as usize + 1)..exit as usize],
+            None => &[],
+        }
+    }
+
+    /// The descendants of an element, resolved to elements.
+    pub fn descendant_elements<'a>(
+        &'a self,
+        graph: &'a ModelGraph,
+        element_id: &ElementId,
+    ) -> impl Iterator<Item = &'a Element> {
+        self.descendants(element_id)
+            .iter()
+            .filter_map(move |id| graph.get_element(id))
+    }
+
+    /// Check whether `ancestor` strictly contains `descendant` in the
+    /// ownership forest. Two integer comparisons after the lookups.
+    pub fn is_ancestor_of(&self, ancestor: &ElementId, descendant: &ElementId) -> bool {
+        match (self.intervals.get(ancestor), self.intervals.get(descendant)) {
+            (Some(&(a_enter, a_exit)), Some(&(d_enter, d_exit))) => {
+                a_enter < d_enter && d_exit <= a_exit
+            }
+            _ => false,
+        }
+    }
+
+    /// The number of indexed elements.
+    pub fn len(&self) -> usize {
+        self.preorder.len()
+    }
+
+    /// Check if the index is empty.
+    pub fn is_empty(&self) -> bool {
+        self.preorder.is_empty()
+    }
+}
+
 /// Find elements by property value.
 pub fn find_by_property<'a>(
     graph: &'a ModelGraph,
@@ -213,6 +568,142 @@ pub fn find_by_property<'a>(
         .filter(move |e| e.get_prop(key) == Some(value))
 }
 
+/// Element count above which [`Query::execute`] scans in parallel.
+///
+/// Mirrors the threshold used by parallel structural validation: below it,
+/// rayon's overhead outweighs the benefit of splitting the scan.
+const QUERY_PARALLEL_THRESHOLD: usize = 5000;
+
+/// A composable element query, fused into a single scan.
+///
+/// The free functions in this crate (`find_by_name`, `find_by_property`,
+/// `requirements_applicable`, ...) each make an independent pass over
+/// `graph.elements`; chaining many of them scans the model once per
+/// predicate. A `Query` collects all predicates first and applies them in
+/// one fused traversal, which runs in parallel chunks for large graphs.
+/// Results always come back in element-id order, independent of scheduling.
+///
+/// # Example
+///
+/// ```
+/// use sysml_core::{Element, ElementKind, ModelGraph};
+/// use sysml_query::Query;
+///
+/// let mut graph = ModelGraph::new();
+/// graph.add_element(Element::new_with_kind(ElementKind::PartUsage).with_name("Engine"));
+///
+/// let results = Query::new(&graph)
+///     .kind(ElementKind::PartUsage)
+///     .name_contains("Eng")
+///     .execute();
+/// assert_eq!(results.len(), 1);
+/// ```
+pub struct Query<'a> {
+    graph: &'a ModelGraph,
+    filters: Vec<Box<dyn Fn(&Element) -> bool + Send + Sync + 'a>>,
+}
+
+impl<'a> Query<'a> {
+    /// Start a new query over a graph.
+    pub fn new(graph: &'a ModelGraph) -> Self {
+        Query {
+            graph,
+            filters: Vec::new(),
+        }
+    }
+
+    /// Keep only elements of the given kind.
+    pub fn kind(self, kind: ElementKind) -> Self {
+        self.filter(move |e| e.kind == kind)
+    }
+
+    /// Keep only elements whose name matches exactly.
+    pub fn name(self, name: &'a str) -> Self {
+        self.filter(move |e| e.name.as_deref() == Some(name))
+    }
+
+    /// Keep only elements whose name contains the pattern.
+    pub fn name_contains(self, pattern: &'a str) -> Self {
+        self.filter(move |e| e.name.as_ref().map_or(false, |n| n.contains(pattern)))
+    }
+
+    /// Keep only elements with the given property value.
+    pub fn prop(self, key: &'a str, value: Value) -> Self {
+        self.filter(move |e| e.get_prop(key) == Some(&value))
+    }
+
+    /// Keep only elements matching an arbitrary predicate.
+    pub fn filter(mut self, predicate: impl Fn(&Element) -> bool + Send + Sync + 'a) -> Self {
+        self.filters.push(Box::new(predicate));
+        self
+    }
+
+    /// Check whether an element passes every filter in the pipeline.
+    fn matches(&self, element: &Element) -> bool {
+        self.filters.iter().all(|f| f(element))
+    }
+
+    /// Execute the fused query with one pass over the elements.
+    ///
+    /// Large graphs are scanned in parallel chunks; the result order is
+    /// element-id order either way.
+    pub fn execute(&self) -> Vec<&'a Element> {
+        if self.graph.element_count() >= QUERY_PARALLEL_THRESHOLD {
+            use rayon::prelude::*;
+
+            // Flatten the BTreeMap once so the scan is an indexed split.
+            let elements: Vec<&Element> = self.graph.elements.values().collect();
+            elements
+                .into_par_iter()
+                .filter(|e| self.matches(e))
+                .collect()
+        } else {
+            self.graph
+                .elements
+                .values()
+                .filter(|e| self.matches(e))
+                .collect()
+        }
+    }
+
+    /// Execute the query and project each match, in element-id order.
+    pub fn select<T: Send>(&self, project: impl Fn(&'a Element) -> T + Send + Sync) -> Vec<T> {
+        if self.graph.element_count() >= QUERY_PARALLEL_THRESHOLD {
+            use rayon::prelude::*;
+
+            let elements: Vec<&Element> = self.graph.elements.values().collect();
+            elements
+                .into_par_iter()
+                .filter(|e| self.matches(e))
+                .map(project)
+                .collect()
+        } else {
+            self.graph
+                .elements
+                .values()
+                .filter(|e| self.matches(e))
+                .map(project)
+                .collect()
+        }
+    }
+
+    /// Execute the query and count the matches.
+    pub fn count(&self) -> usize {
+        if self.graph.element_count() >= QUERY_PARALLEL_THRESHOLD {
+            use rayon::prelude::*;
+
+            let elements: Vec<&Element> = self.graph.elements.values().collect();
+            elements.into_par_iter().filter(|e| self.matches(e)).count()
+        } else {
+            self.graph
+                .elements
+                .values()
+                .filter(|e| self.matches(e))
+                .count()
+        }
+    }
+}
+
 /// Count relationships by kind.
 pub fn count_relationships_by_kind(graph: &ModelGraph) -> std::collections::HashMap<String, usize> {
     let mut counts = std::collections::HashMap::new();
@@ -335,6 +826,86 @@ mod tests {
         assert_eq!(matrix[0].target_name, Some("SafetyReq".to_string()));
     }
 
+    #[test]
+    fn test_trace_index_matches_scanning_queries() {
+        let graph = create_test_graph();
+        let index = TraceIndex::build(&graph);
+        assert_eq!(index.len(), 2); // one Satisfy, one Verify
+
+        let req = find_by_name(&graph, Some(&ElementKind::RequirementUsage), "SafetyReq")
+            .next()
+            .unwrap();
+
+        let scanned: Vec<_> = elements_satisfying(&graph, &req.id).map(|e| &e.id).collect();
+        let indexed: Vec<_> = index.elements_satisfying(&graph, &req.id).map(|e| &e.id).collect();
+        assert_eq!(indexed, scanned);
+
+        let scanned: Vec<_> = elements_verifying(&graph, &req.id).map(|e| &e.id).collect();
+        let indexed: Vec<_> = index.elements_verifying(&graph, &req.id).map(|e| &e.id).collect();
+        assert_eq!(indexed, scanned);
+    }
+
+    #[test]
+    fn test_trace_index_matrix_matches_scan() {
+        let graph = create_test_graph();
+        let index = TraceIndex::build(&graph);
+
+        let scanned = trace_matrix(
+            &graph,
+            &ElementKind::PartUsage,
+            &RelationshipKind::Satisfy,
+            &ElementKind::RequirementUsage,
+        );
+        let indexed = index.trace_matrix(
+            &graph,
+            &ElementKind::PartUsage,
+            &RelationshipKind::Satisfy,
+            &ElementKind::RequirementUsage,
+        );
+
+        assert_eq!(indexed.len(), scanned.len());
+        for (a, b) in indexed.iter().zip(scanned.iter()) {
+            assert_eq!(a.source, b.source);
+            assert_eq!(a.target, b.target);
+            assert_eq!(a.relationship, b.relationship);
+        }
+    }
+
+    #[test]
+    fn test_trace_index_incremental_update() {
+        let mut graph = create_test_graph();
+        let mut index = TraceIndex::build(&graph);
+
+        let req = find_by_name(&graph, Some(&ElementKind::RequirementUsage), "PerformanceReq")
+            .next()
+            .unwrap()
+            .id
+            .clone();
+        let part = find_by_name(&graph, Some(&ElementKind::PartUsage), "Engine")
+            .next()
+            .unwrap()
+            .id
+            .clone();
+
+        // Add a new Satisfy relationship and index it incrementally.
+        let rel = Relationship::new(RelationshipKind::Satisfy, part.clone(), req.clone());
+        let rel_id = rel.id.clone();
+        index.add_relationship(&rel);
+        graph.add_relationship(rel);
+
+        assert_eq!(index.elements_satisfying(&graph, &req).count(), 1);
+
+        // Removing it brings the index back in sync.
+        assert!(index.remove_relationship(&rel_id));
+        assert_eq!(index.elements_satisfying(&graph, &req).count(), 0);
+        assert!(!index.remove_relationship(&rel_id));
+
+        // Non-tracing kinds are ignored.
+        let owning = Relationship::new(RelationshipKind::Owning, part, req);
+        index.add_relationship(&owning);
+        assert_eq!(index.len(), 2);
+    }
+
     #[test]
     fn test_ancestors() {
         let graph = create_test_graph();
@@ -356,6 +927,44 @@ mod tests {
         assert_eq!(descendants.len(), 4); // 2 requirements, 1 part, 1 verification case
     }
 
+    #[test]
+    fn test_ownership_index_descendants_match_traversal() {
+        let graph = create_test_graph();
+        let index = OwnershipIndex::build(&graph);
+        assert_eq!(index.len(), graph.element_count());
+
+        let pkg = find_by_name(&graph, Some(&ElementKind::Package), "TestPackage")
+            .next()
+            .unwrap();
+
+        let traversed: std::collections::HashSet<_> =
+            descendants(&graph, &pkg.id).iter().map(|e| e.id.clone()).collect();
+        let indexed: std::collections::HashSet<_> =
+            index.descendants(&pkg.id).iter().cloned().collect();
+        assert_eq!(indexed, traversed);
+        assert_eq!(index.descendant_elements(&graph, &pkg.id).count(), 4);
+    }
+
+    #[test]
+    fn test_ownership_index_is_ancestor_of() {
+        let graph = create_test_graph();
+        let index = OwnershipIndex::build(&graph);
+
+        let pkg = find_by_name(&graph, Some(&ElementKind::Package), "TestPackage")
+            .next()
+            .unwrap();
+        let part = find_by_name(&graph, Some(&ElementKind::PartUsage), "Engine")
+            .next()
+            .unwrap();
+
+        assert!(index.is_ancestor_of(&pkg.id, &part.id));
+        assert!(!index.is_ancestor_of(&part.id, &pkg.id));
+        // Strict: an element is not its own ancestor.
+        assert!(!index.is_ancestor_of(&pkg.id, &pkg.id));
+        // Unknown elements are never ancestors.
+        assert!(!index.is_ancestor_of(&ElementId::new_v4(), &part.id));
+    }
+
     #[test]
     fn test_count_elements_by_kind() {
         let graph = create_test_graph();
@@ -365,6 +974,53 @@ mod tests {
         assert_eq!(counts.get("PartUsage"), Some(&1));
     }
 
+    #[test]
+    fn test_query_fuses_filters() {
+        let graph = create_test_graph();
+
+        let results = Query::new(&graph)
+            .kind(ElementKind::RequirementUsage)
+            .prop("applicability", Value::String("applicable".to_string()))
+            .execute();
+        assert_eq!(results.len(), 1);
+        assert_eq!(results[0].name, Some("SafetyReq".to_string()));
+
+        assert_eq!(Query::new(&graph).name_contains("Req").count(), 2);
+
+        let names = Query::new(&graph)
+            .kind(ElementKind::PartUsage)
+            .select(|e| e.name.clone());
+        assert_eq!(names, vec![Some("Engine".to_string())]);
+    }
+
+    #[test]
+    fn test_query_parallel_scan_is_deterministic() {
+        // Above the parallel threshold, results must still come back in
+        // element-id order.
+        let mut graph = ModelGraph::new();
+        for i in 0..QUERY_PARALLEL_THRESHOLD + 100 {
+            let kind = if i % 2 == 0 {
+                ElementKind::PartUsage
+            } else {
+                ElementKind::AttributeUsage
+            };
+            graph.add_element(Element::new_with_kind(kind).with_name(format!("e{}", i)));
+        }
+
+        let query = Query::new(&graph).kind(ElementKind::PartUsage);
+        let parallel: Vec<_> = query.execute().iter().map(|e| e.id.clone()).collect();
+
+        let sequential: Vec<_> = graph
+            .elements
+            .values()
+            .filter(|e| e.kind == ElementKind::PartUsage)
+            .map(|e| e.id.clone())
+            .collect();
+
+        assert_eq!(parallel, sequential);
+        assert_eq!(query.count(), sequential.len());
+    }
+
     #[test]
     fn test_count_relationships_by_kind() {
         let graph = create_test_graph();
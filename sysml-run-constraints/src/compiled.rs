@@ -0,0 +1,763 @@
+//! Bytecode-compiled constraint evaluation with a vectorized batch mode.
+//!
+//! [`evaluate`](crate::evaluate) re-parses the constraint expression and
+//! resolves every variable through a string-keyed map on each call. For a
+//! trade-study sweep that checks the same constraint set against millions
+//! of parameter combinations, that name resolution is almost all of the
+//! cost.
+//!
+//! [`CompiledConstraintSet`] parses each expression once into a stack
+//! bytecode with variables bound to dense slot indices. Parameters are
+//! supplied as a [`ParameterBlock`] — a columnar buffer with one column
+//! per variable slot and one row per combination — and
+//! [`evaluate_batch`](CompiledConstraintSet::evaluate_batch) runs each
+//! constraint over the block in chunks of 64 rows, so the inner loops are
+//! plain element-wise arithmetic over fixed-size arrays (auto-vectorizer
+//! friendly) and each chunk packs directly into one word of the result
+//! bitmap. No per-row or per-constraint allocation takes place.
+//!
+//! The expression grammar covers comparisons (`<`, `<=`, `>`, `>=`,
+//! `==`, `!=`), arithmetic (`+`, `-`, `*`, `/`, unary `-`), logical
+//! `&&` / `||` / `!`, and parentheses — a superset of what the
+//! interpreter's stub handles. Like the interpreter, an expression that
+//! does not parse compiles to "always satisfied". Unset parameter
+//! columns are NaN, so every comparison against them is violated.
+
+use crate::ConstraintSet;
+use std::collections::HashMap;
+
+/// Rows evaluated per inner-loop chunk; one chunk packs into one bitmap word.
+const LANES: usize = 64;
+
+/// One stack bytecode instruction.
+///
+/// Booleans are represented as 0.0 / 1.0; any non-zero value is truthy,
+/// and the final stack value decides satisfaction.
+#[derive(Debug, Clone, Copy, PartialEq)]
+enum Op {
+    /// Push a parameter column by slot index.
+    Load(u32),
+    /// Push a constant.
+    Const(f64),
+    Add,
+    Sub,
+    Mul,
+    Div,
+    Neg,
+    Lt,
+    Le,
+    Gt,
+    Ge,
+    Eq,
+    Ne,
+    And,
+    Or,
+    Not,
+}
+
+impl Op {
+    /// Net change in stack depth.
+    fn stack_effect(self) -> isize {
+        match self {
+            Op::Load(_) | Op::Const(_) => 1,
+            Op::Neg | Op::Not => 0,
+            _ => -1,
+        }
+    }
+}
+
+/// One constraint lowered to bytecode.
+#[derive(Debug, Clone)]
+struct CompiledConstraint {
+    /// Postfix instruction sequence; empty means "always satisfied".
+    ops: Vec<Op>,
+    /// Source expression, kept for reporting.
+    expr: String,
+}
+
+/// A [`ConstraintSet`] compiled to slot-bound stack bytecode.
+///
+/// # Examples
+///
+/// ```
+/// use sysml_run::ConstraintIR;
+/// use sysml_run_constraints::{CompiledConstraintSet, ConstraintSet};
+///
+/// let mut set = ConstraintSet::new();
+/// set.add(ConstraintIR::new("speed < 100"));
+/// set.add(ConstraintIR::new("mass * 9.81 <= load"));
+///
+/// let compiled = CompiledConstraintSet::compile(&set);
+/// let speed = compiled.variable_slot("speed").unwrap();
+/// let mass = compiled.variable_slot("mass").unwrap();
+/// let load = compiled.variable_slot("load").unwrap();
+///
+/// let mut block = compiled.parameter_block(2);
+/// block.column_mut(speed).copy_from_slice(&[80.0, 120.0]);
+/// block.column_mut(mass).copy_from_slice(&[10.0, 10.0]);
+/// block.column_mut(load).copy_from_slice(&[200.0, 200.0]);
+///
+/// let results = compiled.evaluate_batch(&block);
+/// assert!(results.is_satisfied(0, 0));
+/// assert!(!results.is_satisfied(0, 1));
+/// assert_eq!(results.count_satisfied(1), 2);
+/// ```
+#[derive(Debug, Clone)]
+pub struct CompiledConstraintSet {
+    /// Variable names, indexed by slot.
+    variable_names: Vec<String>,
+    constraints: Vec<CompiledConstraint>,
+    /// Deepest operand stack any constraint needs.
+    max_stack: usize,
+}
+
+impl CompiledConstraintSet {
+    /// Compile every constraint in a set.
+    ///
+    /// Expressions the grammar cannot parse compile to "always
+    /// satisfied", matching the interpreter's stub behavior for unknown
+    /// expressions.
+    pub fn compile(set: &ConstraintSet) -> Self {
+        let mut variable_names: Vec<String> = Vec::new();
+        let mut variable_slots: HashMap<String, u32> = HashMap::new();
+        let mut max_stack = 0usize;
+
+        let constraints = set
+            .constraints
+            .iter()
+            .map(|c| {
+                let ops = Parser::new(&c.expr, &mut variable_slots, &mut variable_names)
+                    .parse()
+                    .unwrap_or_default();
+
+                let mut depth = 0isize;
+                for op in &ops {
+                    depth += op.stack_effect();
+                    max_stack = max_stack.max(depth as usize);
+                }
+
+                CompiledConstraint {
+                    ops,
+                    expr: c.expr.clone(),
+                }
+            })
+            .collect();
+
+        CompiledConstraintSet {
+            variable_names,
+            constraints,
+            max_stack,
+        }
+    }
+
+    /// Number of compiled constraints.
+    pub fn constraint_count(&self) -> usize {
+        self.constraints.len()
+    }
+
+    /// Number of variable slots (parameter columns).
+    pub fn variable_count(&self) -> usize {
+        self.variable_names.len()
+    }
+
+    /// Look up a variable slot by name.
+    pub fn variable_slot(&self, name: &str) -> Option<u32> {
+        self.variable_names.iter().position(|n| n == name).map(|i| i as u32)
+    }
+
+    /// The variable name for a slot.
+    pub fn variable_name(&self, slot: u32) -> &str {
+        &self.variable_names[slot as usize]
+    }
+
+    /// The source expression of a constraint.
+    pub fn expr(&self, constraint: usize) -> &str {
+        &self.constraints[constraint].expr
+    }
+
+    /// Allocate a parameter block for this set's variables.
+    ///
+    /// All cells start as NaN; fill every column before evaluating, or
+    /// comparisons touching the unset column are violated.
+    pub fn parameter_block(&self, rows: usize) -> ParameterBlock {
+        ParameterBlock {
+            rows,
+            columns: vec![f64::NAN; self.variable_names.len() * rows],
+        }
+    }
+
+    /// Evaluate one row of parameter values, `variable_count` long.
+    ///
+    /// Convenience for spot checks; sweeps should use
+    /// [`evaluate_batch`](Self::evaluate_batch).
+    pub fn evaluate_row(&self, values: &[f64]) -> Vec<bool> {
+        let mut stack = vec![0.0f64; self.max_stack];
+        self.constraints
+            .iter()
+            .map(|c| {
+                if c.ops.is_empty() {
+                    return true;
+                }
+                let mut sp = 0usize;
+                for &op in &c.ops {
+                    scalar_step(op, values, &mut stack, &mut sp);
+                }
+                stack[0] != 0.0
+            })
+            .collect()
+    }
+
+    /// Evaluate every constraint against every row of a parameter block.
+    ///
+    /// Rows are processed in chunks of [`LANES`]; each chunk packs into
+    /// one word of the returned bitmap.
+    pub fn evaluate_batch(&self, block: &ParameterBlock) -> ConstraintBitmap {
+        assert_eq!(
+            block.columns.len(),
+            self.variable_names.len() * block.rows,
+            "parameter block shape does not match this constraint set"
+        );
+
+        let rows = block.rows;
+        let words_per_constraint = rows.div_ceil(LANES);
+        let mut words = vec![0u64; self.constraints.len() * words_per_constraint];
+        let mut stack: Vec<[f64; LANES]> = vec![[0.0; LANES]; self.max_stack.max(1)];
+
+        for (index, constraint) in self.constraints.iter().enumerate() {
+            let out = &mut words[index * words_per_constraint..(index + 1) * words_per_constraint];
+
+            if constraint.ops.is_empty() {
+                // Always satisfied: set the bits for every real row.
+                for (w, word) in out.iter_mut().enumerate() {
+                    let lanes = (rows - w * LANES).min(LANES);
+                    *word = ones(lanes);
+                }
+                continue;
+            }
+
+            for (w, word) in out.iter_mut().enumerate() {
+                let base = w * LANES;
+                let lanes = (rows - base).min(LANES);
+                let mut sp = 0usize;
+
+                for &op in &constraint.ops {
+                    vector_step(op, block, base, lanes, &mut stack, &mut sp);
+                }
+
+                let mut packed = 0u64;
+                for (lane, &value) in stack[0][..lanes].iter().enumerate() {
+                    packed |= ((value != 0.0) as u64) << lane;
+                }
+                *word = packed;
+            }
+        }
+
+        ConstraintBitmap {
+            rows,
+            words_per_constraint,
+            words,
+        }
+    }
+}
+
+/// A word with the low `lanes` bits set.
+fn ones(lanes: usize) -> u64 {
+    if lanes == LANES {
+        u64::MAX
+    } else {
+        (1u64 << lanes) - 1
+    }
+}
+
+/// Execute one instruction on the scalar stack.
+fn scalar_step(op: Op, values: &[f64], stack: &mut [f64], sp: &mut usize) {
+    match op {
+        Op::Load(slot) => {
+            stack[*sp] = values.get(slot as usize).copied().unwrap_or(f64::NAN);
+            *sp += 1;
+        }
+        Op::Const(value) => {
+            stack[*sp] = value;
+            *sp += 1;
+        }
+        Op::Neg => stack[*sp - 1] = -stack[*sp - 1],
+        Op::Not => stack[*sp - 1] = (stack[*sp - 1] == 0.0) as u8 as f64,
+        _ => {
+            let rhs = stack[*sp - 1];
+            let lhs = &mut stack[*sp - 2];
+            *lhs = binary(op, *lhs, rhs);
+            *sp -= 1;
+        }
+    }
+}
+
+/// Execute one instruction element-wise over a chunk of the block.
+fn vector_step(
+    op: Op,
+    block: &ParameterBlock,
+    base: usize,
+    lanes: usize,
+    stack: &mut [[f64; LANES]],
+    sp: &mut usize,
+) {
+    match op {
+        Op::Load(slot) => {
+            let column = block.column(slot);
+            stack[*sp][..lanes].copy_from_slice(&column[base..base + lanes]);
+            *sp += 1;
+        }
+        Op::Const(value) => {
+            stack[*sp][..lanes].fill(value);
+            *sp += 1;
+        }
+        Op::Neg => {
+            for v in &mut stack[*sp - 1][..lanes] {
+                *v = -*v;
+            }
+        }
+        Op::Not => {
+            for v in &mut stack[*sp - 1][..lanes] {
+                *v = (*v == 0.0) as u8 as f64;
+            }
+        }
+        _ => {
+            let (below, top) = stack.split_at_mut(*sp - 1);
+            let lhs = &mut below[*sp - 2];
+            let rhs = &top[0];
+            for lane in 0..lanes {
+                lhs[lane] = binary(op, lhs[lane], rhs[lane]);
+            }
+            *sp -= 1;
+        }
+    }
+}
+
+/// Apply a binary instruction to two operands.
+#[inline]
+fn binary(op: Op, lhs: f64, rhs: f64) -> f64 {
+    match op {
+        Op::Add => lhs + rhs,
+        Op::Sub => lhs - rhs,
+        Op::Mul => lhs * rhs,
+        Op::Div => lhs / rhs,
+        Op::Lt => (lhs < rhs) as u8 as f64,
+        Op::Le => (lhs <= rhs) as u8 as f64,
+        Op::Gt => (lhs > rhs) as u8 as f64,
+        Op::Ge => (lhs >= rhs) as u8 as f64,
+        Op::Eq => (lhs == rhs) as u8 as f64,
+        Op::Ne => (lhs != rhs) as u8 as f64,
+        Op::And => (lhs != 0.0 && rhs != 0.0) as u8 as f64,
+        Op::Or => (lhs != 0.0 || rhs != 0.0) as u8 as f64,
+        Op::Load(_) | Op::Const(_) | Op::Neg | Op::Not => unreachable!("not a binary instruction"),
+    }
+}
+
+/// A columnar block of parameter vectors: one column per variable slot,
+/// one row per parameter combination.
+#[derive(Debug, Clone)]
+pub struct ParameterBlock {
+    rows: usize,
+    /// Column-major storage, `columns[slot * rows + row]`.
+    columns: Vec<f64>,
+}
+
+impl ParameterBlock {
+    /// Number of rows (parameter combinations).
+    pub fn rows(&self) -> usize {
+        self.rows
+    }
+
+    /// A variable's column.
+    pub fn column(&self, slot: u32) -> &[f64] {
+        let start = slot as usize * self.rows;
+        &self.columns[start..start + self.rows]
+    }
+
+    /// A variable's column, mutably, for filling in parameter values.
+    pub fn column_mut(&mut self, slot: u32) -> &mut [f64] {
+        let start = slot as usize * self.rows;
+        &mut self.columns[start..start + self.rows]
+    }
+
+    /// Set a single cell.
+    pub fn set(&mut self, slot: u32, row: usize, value: f64) {
+        self.columns[slot as usize * self.rows + row] = value;
+    }
+}
+
+/// Packed satisfied/violated bits, one bitmap per constraint.
+#[derive(Debug, Clone)]
+pub struct ConstraintBitmap {
+    rows: usize,
+    words_per_constraint: usize,
+    words: Vec<u64>,
+}
+
+impl ConstraintBitmap {
+    /// Number of rows each constraint was evaluated against.
+    pub fn rows(&self) -> usize {
+        self.rows
+    }
+
+    /// Number of constraints.
+    pub fn constraint_count(&self) -> usize {
+        if self.words_per_constraint == 0 {
+            0
+        } else {
+            self.words.len() / self.words_per_constraint
+        }
+    }
+
+    /// Whether a constraint is satisfied on a row.
+    pub fn is_satisfied(&self, constraint: usize, row: usize) -> bool {
+        let word = self.words[constraint * self.words_per_constraint + row / LANES];
+        word >> (row % LANES) & 1 != 0
+    }
+
+    /// The packed words of one constraint's bitmap.
+    pub fn constraint_words(&self, constraint: usize) -> &[u64] {
+        let start = constraint * self.words_per_constraint;
+        &self.words[start..start + self.words_per_constraint]
+    }
+
+    /// Count rows on which a constraint is satisfied.
+    pub fn count_satisfied(&self, constraint: usize) -> usize {
+        self.constraint_words(constraint)
+            .iter()
+            .map(|w| w.count_ones() as usize)
+            .sum()
+    }
+
+    /// Whether every constraint is satisfied on a row.
+    pub fn all_satisfied(&self, row: usize) -> bool {
+        (0..self.constraint_count()).all(|c| self.is_satisfied(c, row))
+    }
+}
+
+/// Recursive-descent parser emitting postfix bytecode.
+///
+/// Grammar, loosest binding first: `||`, `&&`, comparisons, `+`/`-`,
+/// `*`/`/`, unary `-`/`!`, then numbers, identifiers, and parentheses.
+struct Parser<'a> {
+    bytes: &'a [u8],
+    pos: usize,
+    variable_slots: &'a mut HashMap<String, u32>,
+    variable_names: &'a mut Vec<String>,
+    ops: Vec<Op>,
+}
+
+impl<'a> Parser<'a> {
+    fn new(
+        expr: &'a str,
+        variable_slots: &'a mut HashMap<String, u32>,
+        variable_names: &'a mut Vec<String>,
+    ) -> Self {
+        Parser {
+            bytes: expr.as_bytes(),
+            pos: 0,
+            variable_slots,
+            variable_names,
+            ops: Vec::new(),
+        }
+    }
+
+    /// Parse the whole expression; `None` if any of it does not parse.
+    fn parse(mut self) -> Option<Vec<Op>> {
+        self.or_expr()?;
+        self.skip_whitespace();
+        (self.pos == self.bytes.len()).then_some(self.ops)
+    }
+
+    fn or_expr(&mut self) -> Option<()> {
+        self.and_expr()?;
+        while self.eat("||") {
+            self.and_expr()?;
+            self.ops.push(Op::Or);
+        }
+        Some(())
+    }
+
+    fn and_expr(&mut self) -> Option<()> {
+        self.comparison()?;
+        while self.eat("&&") {
+            self.comparison()?;
+            self.ops.push(Op::And);
+        }
+        Some(())
+    }
+
+    fn comparison(&mut self) -> Option<()> {
+        self.sum()?;
+        // Two-character operators must be tried before their prefixes.
+        for (token, op) in [
+            ("<=", Op::Le),
+            (">=", Op::Ge),
+            ("==", Op::Eq),
+            ("!=", Op::Ne),
+            ("<", Op::Lt),
+            (">", Op::Gt),
+        ] {
+            if self.eat(token) {
+                self.sum()?;
+                self.ops.push(op);
+                break;
+            }
+        }
+        Some(())
+    }
+
+    fn sum(&mut self) -> Option<()> {
+        self.term()?;
+        loop {
+            if self.eat("+") {
+                self.term()?;
+                self.ops.push(Op::Add);
+            } else if self.eat("-") {
+                self.term()?;
+                self.ops.push(Op::Sub);
+            } else {
+                return Some(());
+            }
+        }
+    }
+
+    fn term(&mut self) -> Option<()> {
+        self.unary()?;
+        loop {
+            if self.eat("*") {
+                self.unary()?;
+                self.ops.push(Op::Mul);
+            } else if self.eat("/") {
+                self.unary()?;
+                self.ops.push(Op::Div);
+            } else {
+                return Some(());
+            }
+        }
+    }
+
+    fn unary(&mut self) -> Option<()> {
+        if self.eat("-") {
+            self.unary()?;
+            self.ops.push(Op::Neg);
+            return Some(());
+        }
+        if self.eat_not() {
+            self.unary()?;
+            self.ops.push(Op::Not);
+            return Some(());
+        }
+        self.primary()
+    }
+
+    fn primary(&mut self) -> Option<()> {
+        self.skip_whitespace();
+        if self.eat("(") {
+            self.or_expr()?;
+            return self.eat(")").then_some(());
+        }
+
+        let start = self.pos;
+        match self.bytes.get(self.pos)? {
+            b'0'..=b'9' | b'.' => {
+                while matches!(
+                    self.bytes.get(self.pos),
+                    Some(b'0'..=b'9' | b'.' | b'e' | b'E')
+                ) || (matches!(self.bytes.get(self.pos), Some(b'+' | b'-'))
+                    && matches!(self.bytes.get(self.pos - 1), Some(b'e' | b'E')))
+                {
+                    self.pos += 1;
+                }
+                let text = std::str::from_utf8(&self.bytes[start..self.pos]).ok()?;
+                self.ops.push(Op::Const(text.parse().ok()?));
+                Some(())
+            }
+            b'a'..=b'z' | b'A'..=b'Z' | b'_' => {
+                while matches!(
+                    self.bytes.get(self.pos),
+                    Some(b'a'..=b'z' | b'A'..=b'Z' | b'0'..=b'9' | b'_' | b'.')
+                ) {
+                    self.pos += 1;
+                }
+                let name = std::str::from_utf8(&self.bytes[start..self.pos]).ok()?;
+                let next = self.variable_names.len() as u32;
+                let slot = *self.variable_slots.entry(name.to_string()).or_insert_with(|| {
+                    self.variable_names.push(name.to_string());
+                    next
+                });
+                self.ops.push(Op::Load(slot));
+                Some(())
+            }
+            _ => None,
+        }
+    }
+
+    /// Consume a token after whitespace, if present.
+    fn eat(&mut self, token: &str) -> bool {
+        self.skip_whitespace();
+        if self.bytes[self.pos..].starts_with(token.as_bytes()) {
+            self.pos += token.len();
+            true
+        } else {
+            false
+        }
+    }
+
+    /// Consume a `!` that is not part of `!=`.
+    fn eat_not(&mut self) -> bool {
+        self.skip_whitespace();
+        if self.bytes.get(self.pos) == Some(&b'!') && self.bytes.get(self.pos + 1) != Some(&b'=') {
+            self.pos += 1;
+            true
+        } else {
+            false
+        }
+    }
+
+    fn skip_whitespace(&mut self) {
+        while matches!(self.bytes.get(self.pos), Some(b' ' | b'\t' | b'\n' | b'\r')) {
+            self.pos += 1;
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::{evaluate, EvaluationContext};
+    use sysml_run::ConstraintIR;
+
+    fn set_of(exprs: &[&str]) -> ConstraintSet {
+        let mut set = ConstraintSet::new();
+        for expr in exprs {
+            set.add(ConstraintIR::new(*expr));
+        }
+        set
+    }
+
+    #[test]
+    fn compiled_matches_interpreter_on_simple_comparisons() {
+        let set = set_of(&["x < 10", "x > 0", "x == 5", "x >= 5"]);
+        let compiled = CompiledConstraintSet::compile(&set);
+
+        for value in [-3.0, 0.0, 5.0, 9.5, 10.0, 42.0] {
+            let mut context = EvaluationContext::new();
+            context.set("x", value);
+            let expected: Vec<bool> = set
+                .constraints
+                .iter()
+                .map(|c| evaluate(c, &context).satisfied)
+                .collect();
+            assert_eq!(compiled.evaluate_row(&[value]), expected, "x = {}", value);
+        }
+    }
+
+    #[test]
+    fn arithmetic_and_logic_in_expressions() {
+        let set = set_of(&[
+            "mass * 9.81 <= load",
+            "(a + b) / 2 > threshold",
+            "x > 0 && x < 100",
+            "low || high",
+            "!(x == 0)",
+        ]);
+        let compiled = CompiledConstraintSet::compile(&set);
+        assert_eq!(compiled.variable_count(), 8);
+
+        let slot = |name: &str| compiled.variable_slot(name).unwrap() as usize;
+        let mut values = vec![0.0; compiled.variable_count()];
+        values[slot("mass")] = 10.0;
+        values[slot("load")] = 200.0;
+        values[slot("a")] = 4.0;
+        values[slot("b")] = 8.0;
+        values[slot("threshold")] = 5.0;
+        values[slot("x")] = 50.0;
+        values[slot("low")] = 0.0;
+        values[slot("high")] = 1.0;
+
+        assert_eq!(compiled.evaluate_row(&values), vec![true, true, true, true, true]);
+
+        values[slot("mass")] = 30.0;
+        values[slot("high")] = 0.0;
+        assert_eq!(compiled.evaluate_row(&values), vec![false, true, true, false, true]);
+    }
+
+    #[test]
+    fn batch_matches_row_evaluation_across_word_boundary() {
+        let set = set_of(&["x < 100", "x * 2 >= y"]);
+        let compiled = CompiledConstraintSet::compile(&set);
+        let x = compiled.variable_slot("x").unwrap();
+        let y = compiled.variable_slot("y").unwrap();
+
+        // More than one 64-row word, with a ragged tail.
+        let rows = 150;
+        let mut block = compiled.parameter_block(rows);
+        for row in 0..rows {
+            block.set(x, row, row as f64);
+            block.set(y, row, (rows - row) as f64);
+        }
+
+        let results = compiled.evaluate_batch(&block);
+        assert_eq!(results.rows(), rows);
+        assert_eq!(results.constraint_count(), 2);
+
+        for row in 0..rows {
+            let expected = compiled.evaluate_row(&[row as f64, (rows - row) as f64]);
+            assert_eq!(results.is_satisfied(0, row), expected[0], "row {}", row);
+            assert_eq!(results.is_satisfied(1, row), expected[1], "row {}", row);
+        }
+
+        assert_eq!(results.count_satisfied(0), 100);
+    }
+
+    #[test]
+    fn unparsable_expressions_are_always_satisfied() {
+        // The interpreter assumes unknown expressions hold; the compiler
+        // keeps that behavior rather than failing the whole set.
+        let set = set_of(&["forall p in parts: p.mass > 0", "x < 1"]);
+        let compiled = CompiledConstraintSet::compile(&set);
+
+        let x = compiled.variable_slot("x").unwrap();
+        let mut block = compiled.parameter_block(70);
+        block.column_mut(x).fill(5.0);
+
+        let results = compiled.evaluate_batch(&block);
+        assert_eq!(results.count_satisfied(0), 70);
+        assert_eq!(results.count_satisfied(1), 0);
+    }
+
+    #[test]
+    fn unset_columns_violate_comparisons() {
+        let set = set_of(&["x > 0"]);
+        let compiled = CompiledConstraintSet::compile(&set);
+
+        let block = compiled.parameter_block(3);
+        let results = compiled.evaluate_batch(&block);
+        assert_eq!(results.count_satisfied(0), 0);
+    }
+
+    #[test]
+    fn all_satisfied_per_row() {
+        let set = set_of(&["x > 0", "x < 10"]);
+        let compiled = CompiledConstraintSet::compile(&set);
+        let x = compiled.variable_slot("x").unwrap();
+
+        let mut block = compiled.parameter_block(3);
+        block.column_mut(x).copy_from_slice(&[-1.0, 5.0, 20.0]);
+
+        let results = compiled.evaluate_batch(&block);
+        assert!(!results.all_satisfied(0));
+        assert!(results.all_satisfied(1));
+        assert!(!results.all_satisfied(2));
+    }
+
+    #[test]
+    fn variables_share_slots_across_constraints() {
+        let set = set_of(&["x < 10", "x + y > 0", "y != 0"]);
+        let compiled = CompiledConstraintSet::compile(&set);
+        assert_eq!(compiled.variable_count(), 2);
+        assert_eq!(compiled.variable_name(0), "x");
+        assert_eq!(compiled.variable_name(1), "y");
+        assert_eq!(compiled.expr(1), "x + y > 0");
+    }
+}
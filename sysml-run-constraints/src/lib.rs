@@ -5,6 +5,16 @@
 //! This crate provides:
 //! - Extraction of constraints from ModelGraph
 //! - A simple constraint evaluator (stub)
+//! - A bytecode compiler and vectorized batch evaluator for large
+//!   parameter sweeps
+//! - Scoped extraction of one namespace subtree, with an incremental
+//!   per-subtree cache
+
+pub mod compiled;
+pub mod scoped;
+
+pub use compiled::{CompiledConstraintSet, ConstraintBitmap, ParameterBlock};
+pub use scoped::{extract_constraints_in, subtree_fingerprint, ConstraintCache};
 
 use std::collections::HashMap;
 use sysml_core::{ElementKind, ModelGraph, Value};
@@ -55,25 +65,32 @@ impl Default for ConstraintSet {
 pub fn extract_constraints(graph: &ModelGraph) -> ConstraintSet {
     let mut set = ConstraintSet::new();
 
-    // Look for elements with constraint property
     for element in graph.elements.values() {
-        if let Some(constraint_expr) = element.get_prop("constraint").and_then(|v| v.as_str()) {
-            let constraint = ConstraintIR::new(constraint_expr)
-                .with_description(element.name.clone().unwrap_or_default());
-            set.add(constraint);
-        }
-
-        // Also check for "expr" property (common pattern)
-        if let Some(expr) = element.get_prop("expr").and_then(|v| v.as_str()) {
-            let constraint = ConstraintIR::new(expr)
-                .with_description(element.name.clone().unwrap_or_default());
-            set.add(constraint);
-        }
+        element_constraints(element, &mut set);
     }
 
     set
 }
 
+/// Add the constraints one element contributes to a set.
+///
+/// Shared by the full-graph and scoped extraction paths.
+pub(crate) fn element_constraints(element: &sysml_core::Element, set: &mut ConstraintSet) {
+    // Look for elements with constraint property
+    if let Some(constraint_expr) = element.get_prop("constraint").and_then(|v| v.as_str()) {
+        let constraint = ConstraintIR::new(constraint_expr)
+            .with_description(element.name.clone().unwrap_or_default());
+        set.add(constraint);
+    }
+
+    // Also check for "expr" property (common pattern)
+    if let Some(expr) = element.get_prop("expr").and_then(|v| v.as_str()) {
+        let constraint = ConstraintIR::new(expr)
+            .with_description(element.name.clone().unwrap_or_default());
+        set.add(constraint);
+    }
+}
+
 /// The result of evaluating a constraint.
 #[derive(Debug, Clone)]
 pub struct EvaluationResult {
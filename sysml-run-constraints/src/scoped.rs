@@ -0,0 +1,320 @@
+//! Scoped, lazily cached constraint extraction.
+//!
+//! [`extract_constraints`](crate::extract_constraints) walks the entire
+//! [`ModelGraph`], which on a merged model costs more than a small
+//! evaluation run over one subsystem's constraints. When a sweep only
+//! exercises one namespace subtree, extracting the rest of the model is
+//! wasted work.
+//!
+//! [`extract_constraints_in`] extracts just the subtree under one root,
+//! driving off the graph's ownership index (`children_of`) instead of a
+//! full element scan. [`ConstraintCache`] layers an incremental cache on
+//! top: each entry is keyed by the root element and guarded by a
+//! fingerprint of the subtree's constraint-relevant content, so repeated
+//! sweeps over an unchanged subsystem skip extraction entirely — the
+//! revalidation pass only hashes ids, names, and the two constraint
+//! properties, allocating nothing.
+
+use std::collections::hash_map::DefaultHasher;
+use std::collections::{HashMap, HashSet};
+use std::hash::{Hash, Hasher};
+
+use sysml_core::{Element, ElementId, ModelGraph};
+
+use crate::{element_constraints, ConstraintSet};
+
+/// Extract constraints from one namespace subtree.
+///
+/// Visits the root element and every element owned (transitively)
+/// beneath it, in depth-first order with children visited in id order,
+/// so the resulting set is deterministic. Per-element extraction matches
+/// [`extract_constraints`](crate::extract_constraints): the
+/// `constraint` and `expr` properties each contribute one constraint.
+pub fn extract_constraints_in(graph: &ModelGraph, root: &ElementId) -> ConstraintSet {
+    let mut set = ConstraintSet::new();
+    let mut visited = HashSet::new();
+    walk_subtree(graph, root, &mut visited, &mut |element| {
+        element_constraints(element, &mut set);
+    });
+    set
+}
+
+/// Fingerprint of a subtree's constraint-relevant content.
+///
+/// Covers each element's id, name, and `constraint` / `expr` properties,
+/// in the same traversal order as [`extract_constraints_in`]. Anything
+/// else may change without invalidating cached extractions.
+pub fn subtree_fingerprint(graph: &ModelGraph, root: &ElementId) -> u64 {
+    let mut hasher = DefaultHasher::new();
+    let mut visited = HashSet::new();
+    walk_subtree(graph, root, &mut visited, &mut |element| {
+        element.id.hash(&mut hasher);
+        element.name.hash(&mut hasher);
+        element
+            .get_prop("constraint")
+            .and_then(|v| v.as_str())
+            .hash(&mut hasher);
+        element
+            .get_prop("expr")
+            .and_then(|v| v.as_str())
+            .hash(&mut hasher);
+    });
+    hasher.finish()
+}
+
+/// Depth-first walk over an ownership subtree, children in id order.
+fn walk_subtree(
+    graph: &ModelGraph,
+    root: &ElementId,
+    visited: &mut HashSet<ElementId>,
+    visit: &mut impl FnMut(&Element),
+) {
+    if !visited.insert(root.clone()) {
+        return;
+    }
+
+    if let Some(element) = graph.get_element(root) {
+        visit(element);
+    }
+
+    let mut children: Vec<&ElementId> = graph.children_of(root).map(|e| &e.id).collect();
+    children.sort_unstable();
+    for child in children {
+        walk_subtree(graph, child, visited, visit);
+    }
+}
+
+/// An incremental cache of per-subtree constraint sets.
+///
+/// Each entry is keyed by the subtree root and revalidated against the
+/// subtree's content fingerprint on every lookup; extraction only runs
+/// when the fingerprint changed (or on first sight).
+///
+/// # Examples
+///
+/// ```
+/// use sysml_core::{Element, ElementKind, ModelGraph};
+/// use sysml_run_constraints::ConstraintCache;
+///
+/// let mut graph = ModelGraph::new();
+/// let pkg = graph.add_element(Element::new_with_kind(ElementKind::Package).with_name("P"));
+/// graph.add_element(
+///     Element::new_with_kind(ElementKind::AttributeUsage)
+///         .with_owner(pkg.clone())
+///         .with_prop("constraint", "x < 10"),
+/// );
+///
+/// let mut cache = ConstraintCache::new();
+/// assert_eq!(cache.constraints_for(&graph, &pkg).len(), 1);
+/// // Second lookup revalidates the fingerprint and reuses the entry.
+/// assert_eq!(cache.constraints_for(&graph, &pkg).len(), 1);
+/// assert_eq!(cache.hits(), 1);
+/// ```
+#[derive(Debug, Clone, Default)]
+pub struct ConstraintCache {
+    entries: HashMap<ElementId, CacheEntry>,
+    hits: usize,
+    misses: usize,
+}
+
+#[derive(Debug, Clone)]
+struct CacheEntry {
+    fingerprint: u64,
+    set: ConstraintSet,
+}
+
+impl ConstraintCache {
+    /// Create an empty cache.
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// The constraints of a namespace subtree, extracted at most once
+    /// per content change.
+    pub fn constraints_for(&mut self, graph: &ModelGraph, root: &ElementId) -> &ConstraintSet {
+        let fingerprint = subtree_fingerprint(graph, root);
+
+        let entry = self
+            .entries
+            .entry(root.clone())
+            .and_modify(|entry| {
+                if entry.fingerprint == fingerprint {
+                    self.hits += 1;
+                } else {
+                    self.misses += 1;
+                    entry.fingerprint = fingerprint;
+                    entry.set = extract_constraints_in(graph, root);
+                }
+            })
+            .or_insert_with(|| {
+                self.misses += 1;
+                CacheEntry {
+                    fingerprint,
+                    set: extract_constraints_in(graph, root),
+                }
+            });
+
+        &entry.set
+    }
+
+    /// Drop the cached entry for one subtree root.
+    pub fn invalidate(&mut self, root: &ElementId) {
+        self.entries.remove(root);
+    }
+
+    /// Drop all cached entries.
+    pub fn clear(&mut self) {
+        self.entries.clear();
+    }
+
+    /// Number of cached subtrees.
+    pub fn len(&self) -> usize {
+        self.entries.len()
+    }
+
+    /// Whether the cache is empty.
+    pub fn is_empty(&self) -> bool {
+        self.entries.is_empty()
+    }
+
+    /// Lookups served without re-extraction.
+    pub fn hits(&self) -> usize {
+        self.hits
+    }
+
+    /// Lookups that (re-)extracted the subtree.
+    pub fn misses(&self) -> usize {
+        self.misses
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use sysml_core::ElementKind;
+
+    /// Two packages, each with constrained children; returns the graph
+    /// and both package ids.
+    fn two_subsystems() -> (ModelGraph, ElementId, ElementId) {
+        let mut graph = ModelGraph::new();
+
+        let power = graph.add_element(Element::new_with_kind(ElementKind::Package).with_name("Power"));
+        graph.add_element(
+            Element::new_with_kind(ElementKind::AttributeUsage)
+                .with_name("VoltageLimit")
+                .with_owner(power.clone())
+                .with_prop("constraint", "voltage < 48"),
+        );
+        let battery = graph.add_element(
+            Element::new_with_kind(ElementKind::PartUsage)
+                .with_name("battery")
+                .with_owner(power.clone()),
+        );
+        graph.add_element(
+            Element::new_with_kind(ElementKind::AttributeUsage)
+                .with_name("ChargeLimit")
+                .with_owner(battery)
+                .with_prop("constraint", "charge <= 1"),
+        );
+
+        let thermal = graph.add_element(Element::new_with_kind(ElementKind::Package).with_name("Thermal"));
+        graph.add_element(
+            Element::new_with_kind(ElementKind::AttributeUsage)
+                .with_name("TempLimit")
+                .with_owner(thermal.clone())
+                .with_prop("constraint", "temp < 85"),
+        );
+
+        (graph, power, thermal)
+    }
+
+    #[test]
+    fn scoped_extraction_only_sees_the_subtree() {
+        let (graph, power, thermal) = two_subsystems();
+
+        let power_set = extract_constraints_in(&graph, &power);
+        assert_eq!(power_set.len(), 2);
+        assert!(power_set.constraints.iter().all(|c| c.expr != "temp < 85"));
+
+        let thermal_set = extract_constraints_in(&graph, &thermal);
+        assert_eq!(thermal_set.len(), 1);
+        assert_eq!(thermal_set.constraints[0].expr, "temp < 85");
+
+        // Together the subtrees cover the full extraction.
+        let full = crate::extract_constraints(&graph);
+        assert_eq!(full.len(), power_set.len() + thermal_set.len());
+    }
+
+    #[test]
+    fn cache_skips_extraction_for_unchanged_subtrees() {
+        let (graph, power, _) = two_subsystems();
+        let mut cache = ConstraintCache::new();
+
+        assert_eq!(cache.constraints_for(&graph, &power).len(), 2);
+        assert_eq!((cache.hits(), cache.misses()), (0, 1));
+
+        assert_eq!(cache.constraints_for(&graph, &power).len(), 2);
+        assert_eq!(cache.constraints_for(&graph, &power).len(), 2);
+        assert_eq!((cache.hits(), cache.misses()), (2, 1));
+        assert_eq!(cache.len(), 1);
+    }
+
+    #[test]
+    fn cache_re_extracts_when_subtree_content_changes() {
+        let (mut graph, power, _) = two_subsystems();
+        let mut cache = ConstraintCache::new();
+
+        assert_eq!(cache.constraints_for(&graph, &power).len(), 2);
+
+        graph.add_element(
+            Element::new_with_kind(ElementKind::AttributeUsage)
+                .with_name("CurrentLimit")
+                .with_owner(power.clone())
+                .with_prop("constraint", "current < 30"),
+        );
+
+        assert_eq!(cache.constraints_for(&graph, &power).len(), 3);
+        assert_eq!((cache.hits(), cache.misses()), (0, 2));
+    }
+
+    #[test]
+    fn unrelated_changes_do_not_invalidate() {
+        let (mut graph, power, thermal) = two_subsystems();
+        let mut cache = ConstraintCache::new();
+
+        cache.constraints_for(&graph, &power);
+
+        // Changing the other subsystem leaves the Power entry valid.
+        graph.add_element(
+            Element::new_with_kind(ElementKind::AttributeUsage)
+                .with_owner(thermal)
+                .with_prop("constraint", "gradient < 5"),
+        );
+
+        cache.constraints_for(&graph, &power);
+        assert_eq!((cache.hits(), cache.misses()), (1, 1));
+    }
+
+    #[test]
+    fn invalidate_and_clear() {
+        let (graph, power, thermal) = two_subsystems();
+        let mut cache = ConstraintCache::new();
+
+        cache.constraints_for(&graph, &power);
+        cache.constraints_for(&graph, &thermal);
+        assert_eq!(cache.len(), 2);
+
+        cache.invalidate(&power);
+        assert_eq!(cache.len(), 1);
+
+        cache.clear();
+        assert!(cache.is_empty());
+    }
+
+    #[test]
+    fn missing_root_yields_empty_set() {
+        let graph = ModelGraph::new();
+        let ghost = ElementId::new_v4();
+        assert!(extract_constraints_in(&graph, &ghost).is_empty());
+    }
+}
@@ -0,0 +1,422 @@
+//! Batch simulation campaigns over a compiled state machine.
+//!
+//! Reliability analyses run very large numbers of independent instances
+//! of the same machine, each with its own event trace. Driving those one
+//! [`step`](crate::CompiledRunner::step) call at a time from an external
+//! loop pays per-call overhead that dwarfs the stepping itself.
+//!
+//! [`Campaign`] batches the whole run: submit N event traces, then
+//! [`run`](Campaign::run) executes every instance across all cores on
+//! rayon's work-stealing pool. Instances are processed in chunks; each
+//! worker task reuses a single [`CompiledRunner`](crate::CompiledRunner)
+//! and a set of chunk-local buffers, so the hot loop allocates nothing
+//! per instance. Results come back in [`CampaignResults`], a columnar
+//! buffer of final states, completion flags, variable slots, and emitted
+//! events, indexed by instance in submission order.
+//!
+//! Traces are stored flattened (one event array plus offsets) rather
+//! than as a `Vec` per instance, so a 100k-instance campaign is two
+//! allocations, not 100k.
+
+use rayon::prelude::*;
+
+use crate::compiled::CompiledStateMachine;
+
+/// Sentinel for "step without an event" in a flattened trace.
+const NO_EVENT: u32 = u32::MAX;
+
+/// Instances per worker task. Large enough to amortize task scheduling,
+/// small enough for work stealing to balance uneven trace lengths.
+const CHUNK_SIZE: usize = 256;
+
+/// Campaigns below this instance count run on the calling thread.
+const PARALLEL_THRESHOLD: usize = 2 * CHUNK_SIZE;
+
+/// A batch of simulation instances over one [`CompiledStateMachine`].
+///
+/// # Examples
+///
+/// ```
+/// use sysml_run::{StateIR, StateMachineIR, TransitionIR};
+/// use sysml_run_statemachine::{Campaign, CompiledStateMachine};
+///
+/// let ir = StateMachineIR::new("Light", "Red")
+///     .with_state(StateIR::new("Red"))
+///     .with_state(StateIR::new("Green"))
+///     .with_transition(TransitionIR::new("Red", "Green").with_event("timer"))
+///     .with_transition(TransitionIR::new("Green", "Red").with_event("timer"));
+///
+/// let compiled = CompiledStateMachine::compile(&ir).unwrap();
+/// let timer = compiled.event_id("timer").unwrap();
+///
+/// let mut campaign = Campaign::new(&compiled);
+/// campaign.add_trace([Some(timer)]);
+/// campaign.add_trace([Some(timer), Some(timer)]);
+///
+/// let results = campaign.run();
+/// assert_eq!(compiled.state_name(results.final_state(0)), "Green");
+/// assert_eq!(compiled.state_name(results.final_state(1)), "Red");
+/// ```
+pub struct Campaign<'a> {
+    machine: &'a CompiledStateMachine,
+    /// Flattened event traces; [`NO_EVENT`] encodes a step without event.
+    events: Vec<u32>,
+    /// Per-instance ranges into `events`, `instance_count() + 1` entries.
+    offsets: Vec<u32>,
+}
+
+impl<'a> Campaign<'a> {
+    /// Create an empty campaign over a compiled machine.
+    pub fn new(machine: &'a CompiledStateMachine) -> Self {
+        Campaign {
+            machine,
+            events: Vec::new(),
+            offsets: vec![0],
+        }
+    }
+
+    /// Pre-size the trace buffers for an expected instance and event count.
+    pub fn with_capacity(machine: &'a CompiledStateMachine, instances: usize, events: usize) -> Self {
+        let mut offsets = Vec::with_capacity(instances + 1);
+        offsets.push(0);
+        Campaign {
+            machine,
+            events: Vec::with_capacity(events),
+            offsets,
+        }
+    }
+
+    /// Submit one instance with its event trace; returns the instance index.
+    ///
+    /// `None` entries step the machine without an event (firing only
+    /// event-less transitions). Event indexes come from
+    /// [`CompiledStateMachine::event_id`].
+    pub fn add_trace(&mut self, events: impl IntoIterator<Item = Option<u32>>) -> usize {
+        self.events
+            .extend(events.into_iter().map(|e| e.unwrap_or(NO_EVENT)));
+        self.offsets.push(self.events.len() as u32);
+        self.offsets.len() - 2
+    }
+
+    /// Submit one instance with events given by name; returns the index.
+    ///
+    /// Convenience for tests and small campaigns; unknown names step
+    /// without an event, as in the interpreter. Hot paths should intern
+    /// once and use [`add_trace`](Self::add_trace).
+    pub fn add_named_trace<I, S>(&mut self, events: I) -> usize
+    where
+        I: IntoIterator<Item = S>,
+        S: AsRef<str>,
+    {
+        let machine = self.machine;
+        self.events.extend(
+            events
+                .into_iter()
+                .map(|e| machine.event_id(e.as_ref()).unwrap_or(NO_EVENT)),
+        );
+        self.offsets.push(self.events.len() as u32);
+        self.offsets.len() - 2
+    }
+
+    /// Number of submitted instances.
+    pub fn instance_count(&self) -> usize {
+        self.offsets.len() - 1
+    }
+
+    /// The flattened event trace of an instance.
+    fn trace(&self, instance: usize) -> &[u32] {
+        let start = self.offsets[instance] as usize;
+        let end = self.offsets[instance + 1] as usize;
+        &self.events[start..end]
+    }
+
+    /// Execute every instance and collect columnar results.
+    ///
+    /// Instances run across all cores in chunks of [`CHUNK_SIZE`]; small
+    /// campaigns run on the calling thread. Results are in submission
+    /// order regardless of scheduling.
+    pub fn run(&self) -> CampaignResults {
+        let instances = self.instance_count();
+        if instances == 0 {
+            return CampaignResults::empty(self.machine.variable_count());
+        }
+
+        if instances < PARALLEL_THRESHOLD {
+            let chunk = self.run_chunk(0..instances);
+            return CampaignResults::from_chunks(self.machine.variable_count(), instances, vec![chunk]);
+        }
+
+        let chunk_count = instances.div_ceil(CHUNK_SIZE);
+        let chunks: Vec<ChunkResults> = (0..chunk_count)
+            .into_par_iter()
+            .map(|c| {
+                let start = c * CHUNK_SIZE;
+                let end = (start + CHUNK_SIZE).min(instances);
+                self.run_chunk(start..end)
+            })
+            .collect();
+
+        CampaignResults::from_chunks(self.machine.variable_count(), instances, chunks)
+    }
+
+    /// Run a contiguous range of instances on one reused runner.
+    fn run_chunk(&self, range: std::ops::Range<usize>) -> ChunkResults {
+        let variable_count = self.machine.variable_count();
+        let count = range.len();
+        let mut chunk = ChunkResults {
+            final_states: Vec::with_capacity(count),
+            completed: Vec::with_capacity(count),
+            variables: Vec::with_capacity(count * variable_count),
+            emitted: Vec::new(),
+            emitted_counts: Vec::with_capacity(count),
+        };
+
+        let mut runner = self.machine.runner();
+        for instance in range {
+            runner.reset();
+            let mut emitted = 0u32;
+            for &event in self.trace(instance) {
+                let event = (event != NO_EVENT).then_some(event);
+                runner.step(event);
+                chunk.emitted.extend_from_slice(runner.emitted());
+                emitted += runner.emitted().len() as u32;
+            }
+            chunk.final_states.push(runner.current_state_id());
+            chunk.completed.push(runner.is_completed());
+            for slot in 0..variable_count {
+                chunk.variables.push(runner.variable(slot as u32));
+            }
+            chunk.emitted_counts.push(emitted);
+        }
+
+        chunk
+    }
+}
+
+/// Per-chunk output buffers, concatenated into [`CampaignResults`].
+struct ChunkResults {
+    final_states: Vec<u32>,
+    completed: Vec<bool>,
+    variables: Vec<f64>,
+    emitted: Vec<u32>,
+    emitted_counts: Vec<u32>,
+}
+
+/// Columnar results of a [`Campaign`], indexed by instance in
+/// submission order.
+#[derive(Debug, Clone)]
+pub struct CampaignResults {
+    variable_count: usize,
+    /// Final state index per instance.
+    final_states: Vec<u32>,
+    /// Whether each instance reached a final state.
+    completed: Vec<bool>,
+    /// Variable slots, `variable_count` values per instance.
+    variables: Vec<f64>,
+    /// Events emitted by send actions, flattened across instances.
+    emitted: Vec<u32>,
+    /// Per-instance ranges into `emitted`, `instance_count() + 1` entries.
+    emitted_offsets: Vec<u32>,
+}
+
+impl CampaignResults {
+    fn empty(variable_count: usize) -> Self {
+        CampaignResults {
+            variable_count,
+            final_states: Vec::new(),
+            completed: Vec::new(),
+            variables: Vec::new(),
+            emitted: Vec::new(),
+            emitted_offsets: vec![0],
+        }
+    }
+
+    fn from_chunks(variable_count: usize, instances: usize, chunks: Vec<ChunkResults>) -> Self {
+        let mut results = CampaignResults {
+            variable_count,
+            final_states: Vec::with_capacity(instances),
+            completed: Vec::with_capacity(instances),
+            variables: Vec::with_capacity(instances * variable_count),
+            emitted: Vec::with_capacity(chunks.iter().map(|c| c.emitted.len()).sum()),
+            emitted_offsets: Vec::with_capacity(instances + 1),
+        };
+        results.emitted_offsets.push(0);
+
+        for chunk in chunks {
+            results.final_states.extend_from_slice(&chunk.final_states);
+            results.completed.extend_from_slice(&chunk.completed);
+            results.variables.extend_from_slice(&chunk.variables);
+            results.emitted.extend_from_slice(&chunk.emitted);
+            let mut offset = *results.emitted_offsets.last().unwrap();
+            for count in chunk.emitted_counts {
+                offset += count;
+                results.emitted_offsets.push(offset);
+            }
+        }
+
+        results
+    }
+
+    /// Number of instances in the campaign.
+    pub fn instance_count(&self) -> usize {
+        self.final_states.len()
+    }
+
+    /// Final state index of an instance.
+    pub fn final_state(&self, instance: usize) -> u32 {
+        self.final_states[instance]
+    }
+
+    /// Whether an instance reached a final state.
+    pub fn is_completed(&self, instance: usize) -> bool {
+        self.completed[instance]
+    }
+
+    /// Variable slot values of an instance.
+    pub fn variables(&self, instance: usize) -> &[f64] {
+        let start = instance * self.variable_count;
+        &self.variables[start..start + self.variable_count]
+    }
+
+    /// Events emitted by an instance's send actions, in step order.
+    pub fn emitted(&self, instance: usize) -> &[u32] {
+        let start = self.emitted_offsets[instance] as usize;
+        let end = self.emitted_offsets[instance + 1] as usize;
+        &self.emitted[start..end]
+    }
+
+    /// Final state column for all instances.
+    pub fn final_states(&self) -> &[u32] {
+        &self.final_states
+    }
+
+    /// Completion column for all instances.
+    pub fn completed(&self) -> &[bool] {
+        &self.completed
+    }
+
+    /// Count instances that ended in a given state.
+    pub fn count_in_state(&self, state: u32) -> usize {
+        self.final_states.iter().filter(|&&s| s == state).count()
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use sysml_run::{ActionIR, AssignmentIR, StateIR, StateMachineIR, TransitionIR};
+
+    fn traffic_light() -> StateMachineIR {
+        StateMachineIR::new("TrafficLight", "Red")
+            .with_state(StateIR::new("Red"))
+            .with_state(StateIR::new("Green"))
+            .with_state(StateIR::new("Yellow"))
+            .with_transition(TransitionIR::new("Red", "Green").with_event("timer"))
+            .with_transition(TransitionIR::new("Green", "Yellow").with_event("timer"))
+            .with_transition(TransitionIR::new("Yellow", "Red").with_event("timer"))
+    }
+
+    #[test]
+    fn campaign_matches_single_runner() {
+        let ir = traffic_light();
+        let compiled = CompiledStateMachine::compile(&ir).unwrap();
+        let timer = compiled.event_id("timer").unwrap();
+
+        // Varying trace lengths: instance i takes i timer steps.
+        let mut campaign = Campaign::new(&compiled);
+        for i in 0..100 {
+            campaign.add_trace((0..i).map(|_| Some(timer)));
+        }
+        let results = campaign.run();
+
+        assert_eq!(results.instance_count(), 100);
+        let mut runner = compiled.runner();
+        for i in 0..100 {
+            runner.reset();
+            for _ in 0..i {
+                runner.step(Some(timer));
+            }
+            assert_eq!(results.final_state(i), runner.current_state_id());
+        }
+    }
+
+    #[test]
+    fn parallel_and_serial_paths_agree() {
+        let ir = traffic_light();
+        let compiled = CompiledStateMachine::compile(&ir).unwrap();
+        let timer = compiled.event_id("timer").unwrap();
+
+        // Above PARALLEL_THRESHOLD so the chunked path runs.
+        let instances = 3 * PARALLEL_THRESHOLD + 7;
+        let mut campaign = Campaign::with_capacity(&compiled, instances, instances);
+        for i in 0..instances {
+            campaign.add_trace((0..i % 4).map(|_| Some(timer)));
+        }
+        let results = campaign.run();
+
+        assert_eq!(results.instance_count(), instances);
+        let red = compiled.state_id("Red").unwrap();
+        let expected_red = (0..instances).filter(|i| i % 4 == 0 || i % 4 == 3).count();
+        assert_eq!(results.count_in_state(red), expected_red);
+    }
+
+    #[test]
+    fn columnar_variables_and_emitted_events() {
+        let ir = StateMachineIR::new("Timed", "idle")
+            .with_state(StateIR::new("idle"))
+            .with_state(StateIR::new("active"))
+            .with_transition(
+                TransitionIR::new("idle", "active").with_event("start").with_action_ir(
+                    ActionIR::structured(
+                        vec![AssignmentIR::add("t", 10.0)],
+                        vec!["started".to_string()],
+                    ),
+                ),
+            )
+            .with_transition(TransitionIR::new("active", "idle").with_event("reset"));
+        let compiled = CompiledStateMachine::compile(&ir).unwrap();
+        let t = compiled.variable_slot("t").unwrap();
+        let started = compiled.event_id("started").unwrap();
+
+        let mut campaign = Campaign::new(&compiled);
+        // Instance 0 fires the action twice, instance 1 once, instance 2 never.
+        campaign.add_named_trace(["start", "reset", "start"]);
+        campaign.add_named_trace(["start"]);
+        campaign.add_named_trace(["reset"]);
+        let results = campaign.run();
+
+        assert_eq!(results.variables(0)[t as usize], 20.0);
+        assert_eq!(results.variables(1)[t as usize], 10.0);
+        assert_eq!(results.variables(2)[t as usize], 0.0);
+
+        assert_eq!(results.emitted(0), &[started, started]);
+        assert_eq!(results.emitted(1), &[started]);
+        assert_eq!(results.emitted(2), &[] as &[u32]);
+    }
+
+    #[test]
+    fn completion_is_reported_per_instance() {
+        let ir = StateMachineIR::new("Done", "run")
+            .with_state(StateIR::new("run"))
+            .with_state(StateIR::new("end").final_state())
+            .with_transition(TransitionIR::new("run", "end").with_event("stop"));
+        let compiled = CompiledStateMachine::compile(&ir).unwrap();
+
+        let mut campaign = Campaign::new(&compiled);
+        campaign.add_named_trace(["stop"]);
+        campaign.add_named_trace(Vec::<&str>::new());
+        let results = campaign.run();
+
+        assert!(results.is_completed(0));
+        assert!(!results.is_completed(1));
+        assert_eq!(results.completed(), &[true, false]);
+    }
+
+    #[test]
+    fn empty_campaign() {
+        let ir = traffic_light();
+        let compiled = CompiledStateMachine::compile(&ir).unwrap();
+        let results = Campaign::new(&compiled).run();
+        assert_eq!(results.instance_count(), 0);
+    }
+}
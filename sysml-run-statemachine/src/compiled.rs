@@ -0,0 +1,623 @@
+//! Compiled state machine engine with dense transition tables.
+//!
+//! [`StateMachineRunner`](crate::StateMachineRunner) interprets
+//! [`StateMachineIR`] directly: every step re-filters the transition list
+//! into a fresh `Vec` and compares states and events as strings. That is
+//! fine for a handful of steps but dominates the profile when a machine is
+//! stepped millions of times in a simulation campaign.
+//!
+//! [`CompiledStateMachine`] lowers the IR once into dense numeric form:
+//!
+//! - states and events become `u32` indexes,
+//! - transition dispatch is a single load from a flat table indexed by
+//!   `(state, event)`, with event-less transitions resolved into the table
+//!   at compile time (declaration order decides shadowing, exactly as the
+//!   interpreter's first-match scan does),
+//! - structured action assignments are pre-bound to numeric variable
+//!   slots, and send events to event indexes.
+//!
+//! [`CompiledRunner`] then steps from those tables with no allocation per
+//! step. It mirrors [`StateMachineRunner`] semantics for state dispatch
+//! (guards are carried in the IR but not evaluated, as in the
+//! interpreter); in addition it applies structured assignments to its slot
+//! array and records sends, like the parallel runner's context does.
+//!
+//! Names are only touched at the edges: intern events and variables once
+//! via [`CompiledStateMachine::event_id`] / `variable_slot`, then run the
+//! hot loop on integers.
+
+use std::collections::HashMap;
+
+use sysml_run::{ActionIR, AssignmentOp, StateMachineIR};
+use sysml_span::Diagnostic;
+
+/// Sentinel for "no transition" in the dense table.
+const NO_TRANSITION: u32 = u32::MAX;
+
+/// An assignment pre-bound to a variable slot.
+#[derive(Debug, Clone, PartialEq)]
+struct CompiledAssignment {
+    /// Index into the runner's variable slot array.
+    slot: u32,
+    /// The assignment operator.
+    op: AssignmentOp,
+    /// The constant operand.
+    value: f64,
+}
+
+/// A structured action lowered to slot assignments and event indexes.
+///
+/// Simple (free-text) actions have no numeric effect and compile to an
+/// empty action, matching the interpreter which only logs them.
+#[derive(Debug, Clone, Default, PartialEq)]
+struct CompiledAction {
+    assignments: Vec<CompiledAssignment>,
+    sends: Vec<u32>,
+}
+
+impl CompiledAction {
+    fn is_empty(&self) -> bool {
+        self.assignments.is_empty() && self.sends.is_empty()
+    }
+}
+
+/// A transition lowered to numeric form.
+#[derive(Debug, Clone)]
+struct CompiledTransition {
+    /// Target state index.
+    target: u32,
+    /// Transition action, if it has any numeric effect.
+    action: Option<CompiledAction>,
+}
+
+/// A [`StateMachineIR`] lowered to dense transition tables.
+///
+/// Build one with [`CompiledStateMachine::compile`], then create any
+/// number of [`CompiledRunner`]s over it; the tables are immutable and
+/// can be shared across threads.
+#[derive(Debug, Clone)]
+pub struct CompiledStateMachine {
+    /// State names, indexed by state id.
+    state_names: Vec<String>,
+    /// Event names, indexed by event id.
+    event_names: Vec<String>,
+    /// Variable names, indexed by slot.
+    variable_names: Vec<String>,
+    /// Initial state index.
+    initial: u32,
+    /// Per-state final flag.
+    is_final: Vec<bool>,
+    /// Per-state entry action (only actions with numeric effect are kept).
+    entry_actions: Vec<Option<CompiledAction>>,
+    /// Per-state exit action.
+    exit_actions: Vec<Option<CompiledAction>>,
+    /// Dense dispatch table, `state_count` rows by `event_count + 1`
+    /// columns. Column 0 answers "no event" (and any event name the
+    /// machine never mentions, which only event-less transitions can
+    /// match); column `e + 1` answers event `e`. Entries index into
+    /// `transitions`, or [`NO_TRANSITION`].
+    table: Vec<u32>,
+    /// Transitions referenced by the table.
+    transitions: Vec<CompiledTransition>,
+}
+
+impl CompiledStateMachine {
+    /// Lower a state machine IR into dense tables.
+    ///
+    /// Parallel state machines (those with regions) are not supported;
+    /// compile each region separately or use the parallel runner.
+    ///
+    /// States that appear only as transition endpoints or as the initial
+    /// state are interned like declared states, matching the
+    /// interpreter's tolerance for transitions to undeclared states.
+    pub fn compile(ir: &StateMachineIR) -> Result<Self, Vec<Diagnostic>> {
+        if ir.is_parallel() {
+            return Err(vec![Diagnostic::error(
+                "Parallel state machines cannot be compiled to a dense table; \
+                 compile each region separately",
+            )]);
+        }
+
+        let mut state_names: Vec<String> = Vec::with_capacity(ir.states.len());
+        let mut state_ids: HashMap<&str, u32> = HashMap::new();
+
+        for state in &ir.states {
+            intern(&mut state_ids, &mut state_names, &state.name);
+        }
+        let initial = intern(&mut state_ids, &mut state_names, &ir.initial);
+        for t in &ir.transitions {
+            intern(&mut state_ids, &mut state_names, &t.from);
+            intern(&mut state_ids, &mut state_names, &t.to);
+        }
+        let state_count = state_names.len();
+
+        // Intern events in first-appearance order.
+        let mut event_names: Vec<String> = Vec::new();
+        let mut event_ids: HashMap<&str, u32> = HashMap::new();
+        for t in &ir.transitions {
+            if let Some(event) = &t.event {
+                intern(&mut event_ids, &mut event_names, event);
+            }
+        }
+
+        // Intern variables and send targets while lowering actions.
+        let mut variable_names: Vec<String> = Vec::new();
+        let mut variable_slots: HashMap<&str, u32> = HashMap::new();
+
+        let mut is_final = vec![false; state_count];
+        let mut entry_actions: Vec<Option<CompiledAction>> = vec![None; state_count];
+        let mut exit_actions: Vec<Option<CompiledAction>> = vec![None; state_count];
+        for state in &ir.states {
+            let id = state_ids[state.name.as_str()] as usize;
+            is_final[id] = state.is_final;
+            entry_actions[id] = state.entry_action.as_ref().and_then(|a| {
+                lower_action(a, &mut event_ids, &mut event_names, &mut variable_slots, &mut variable_names)
+            });
+            exit_actions[id] = state.exit_action.as_ref().and_then(|a| {
+                lower_action(a, &mut event_ids, &mut event_names, &mut variable_slots, &mut variable_names)
+            });
+        }
+
+        // Lower all transitions before sizing the table: a send action may
+        // intern an event nothing triggers on, and it still needs an index.
+        let transitions: Vec<CompiledTransition> = ir
+            .transitions
+            .iter()
+            .map(|t| CompiledTransition {
+                target: state_ids[t.to.as_str()],
+                action: t.action.as_ref().and_then(|a| {
+                    lower_action(a, &mut event_ids, &mut event_names, &mut variable_slots, &mut variable_names)
+                }),
+            })
+            .collect();
+
+        let columns = event_names.len() + 1;
+        let mut table = vec![NO_TRANSITION; state_count * columns];
+
+        // Walk transitions in declaration order so the first match wins,
+        // as in the interpreter's linear scan. An event-less transition
+        // matches every column; a named one only its own.
+        for (index, t) in ir.transitions.iter().enumerate() {
+            let index = index as u32;
+
+            let row = state_ids[t.from.as_str()] as usize * columns;
+            match &t.event {
+                None => {
+                    for slot in &mut table[row..row + columns] {
+                        if *slot == NO_TRANSITION {
+                            *slot = index;
+                        }
+                    }
+                }
+                Some(event) => {
+                    let column = event_ids[event.as_str()] as usize + 1;
+                    if table[row + column] == NO_TRANSITION {
+                        table[row + column] = index;
+                    }
+                }
+            }
+        }
+
+        Ok(CompiledStateMachine {
+            state_names,
+            event_names,
+            variable_names,
+            initial,
+            is_final,
+            entry_actions,
+            exit_actions,
+            table,
+            transitions,
+        })
+    }
+
+    /// Number of states (including interned transition endpoints).
+    pub fn state_count(&self) -> usize {
+        self.state_names.len()
+    }
+
+    /// Number of distinct events.
+    pub fn event_count(&self) -> usize {
+        self.event_names.len()
+    }
+
+    /// Number of variable slots.
+    pub fn variable_count(&self) -> usize {
+        self.variable_names.len()
+    }
+
+    /// Look up a state index by name.
+    pub fn state_id(&self, name: &str) -> Option<u32> {
+        self.state_names.iter().position(|n| n == name).map(|i| i as u32)
+    }
+
+    /// Look up an event index by name. Intern once, then step on integers.
+    pub fn event_id(&self, name: &str) -> Option<u32> {
+        self.event_names.iter().position(|n| n == name).map(|i| i as u32)
+    }
+
+    /// Look up a variable slot by name.
+    pub fn variable_slot(&self, name: &str) -> Option<u32> {
+        self.variable_names.iter().position(|n| n == name).map(|i| i as u32)
+    }
+
+    /// The state name for an index.
+    pub fn state_name(&self, id: u32) -> &str {
+        &self.state_names[id as usize]
+    }
+
+    /// The event name for an index.
+    pub fn event_name(&self, id: u32) -> &str {
+        &self.event_names[id as usize]
+    }
+
+    /// Create a runner positioned at the initial state.
+    pub fn runner(&self) -> CompiledRunner<'_> {
+        CompiledRunner {
+            machine: self,
+            current: self.initial,
+            completed: self.is_final[self.initial as usize],
+            variables: vec![0.0; self.variable_names.len()],
+            emitted: Vec::new(),
+        }
+    }
+
+    #[inline]
+    fn dispatch(&self, state: u32, event: Option<u32>) -> u32 {
+        let columns = self.event_names.len() + 1;
+        let column = match event {
+            Some(e) => e as usize + 1,
+            None => 0,
+        };
+        self.table[state as usize * columns + column]
+    }
+}
+
+/// Intern a name, assigning the next index on first sight.
+fn intern<'a>(ids: &mut HashMap<&'a str, u32>, names: &mut Vec<String>, name: &'a str) -> u32 {
+    *ids.entry(name).or_insert_with(|| {
+        names.push(name.to_string());
+        (names.len() - 1) as u32
+    })
+}
+
+/// Lower a structured action to slot assignments and event indexes.
+///
+/// Simple (free-text) actions and structured actions with no numeric
+/// effect lower to `None`; the interpreter only logs those.
+fn lower_action<'a>(
+    action: &'a ActionIR,
+    event_ids: &mut HashMap<&'a str, u32>,
+    event_names: &mut Vec<String>,
+    variable_slots: &mut HashMap<&'a str, u32>,
+    variable_names: &mut Vec<String>,
+) -> Option<CompiledAction> {
+    let ActionIR::Structured { assignments, sends } = action else {
+        return None;
+    };
+    let mut compiled = CompiledAction::default();
+    for assign in assignments {
+        let slot = intern(variable_slots, variable_names, &assign.variable);
+        compiled.assignments.push(CompiledAssignment {
+            slot,
+            op: assign.operator,
+            value: assign.value,
+        });
+    }
+    for send in sends {
+        let id = intern(event_ids, event_names, send);
+        compiled.sends.push(id);
+    }
+    (!compiled.is_empty()).then_some(compiled)
+}
+
+/// A zero-allocation stepper over a [`CompiledStateMachine`].
+///
+/// Holds only the current state index, a completion flag, the variable
+/// slot array, and a reused buffer for events emitted by send actions.
+/// Many runners can share one compiled machine.
+///
+/// # Examples
+///
+/// ```
+/// use sysml_run::{StateMachineIR, StateIR, TransitionIR};
+/// use sysml_run_statemachine::CompiledStateMachine;
+///
+/// let ir = StateMachineIR::new("Light", "Red")
+///     .with_state(StateIR::new("Red"))
+///     .with_state(StateIR::new("Green"))
+///     .with_transition(TransitionIR::new("Red", "Green").with_event("timer"))
+///     .with_transition(TransitionIR::new("Green", "Red").with_event("timer"));
+///
+/// let compiled = CompiledStateMachine::compile(&ir).unwrap();
+/// let timer = compiled.event_id("timer").unwrap();
+///
+/// let mut runner = compiled.runner();
+/// runner.step(Some(timer));
+/// assert_eq!(runner.current_state_name(), "Green");
+/// ```
+#[derive(Debug, Clone)]
+pub struct CompiledRunner<'a> {
+    machine: &'a CompiledStateMachine,
+    current: u32,
+    completed: bool,
+    variables: Vec<f64>,
+    emitted: Vec<u32>,
+}
+
+impl<'a> CompiledRunner<'a> {
+    /// Execute a single step, optionally triggered by an event index.
+    ///
+    /// Returns the state index after the step. Exit, transition, and
+    /// entry actions are applied to the variable slots in that order;
+    /// sends are appended to [`emitted`](Self::emitted) (cleared at the
+    /// start of each step). Event indexes come from
+    /// [`CompiledStateMachine::event_id`].
+    pub fn step(&mut self, event: Option<u32>) -> u32 {
+        self.emitted.clear();
+        if self.completed {
+            return self.current;
+        }
+
+        let machine = self.machine;
+        let index = machine.dispatch(self.current, event);
+        if index != NO_TRANSITION {
+            if let Some(exit) = &machine.exit_actions[self.current as usize] {
+                Self::apply(exit, &mut self.variables, &mut self.emitted);
+            }
+
+            let transition = &machine.transitions[index as usize];
+            if let Some(action) = &transition.action {
+                Self::apply(action, &mut self.variables, &mut self.emitted);
+            }
+
+            self.current = transition.target;
+
+            if let Some(entry) = &machine.entry_actions[self.current as usize] {
+                Self::apply(entry, &mut self.variables, &mut self.emitted);
+            }
+
+            if machine.is_final[self.current as usize] {
+                self.completed = true;
+            }
+        }
+
+        self.current
+    }
+
+    /// Step by event name, interning on the fly.
+    ///
+    /// Convenience for tests and one-off use; hot loops should intern
+    /// the event once and call [`step`](Self::step). An unknown event
+    /// name can only match event-less transitions, as in the
+    /// interpreter.
+    pub fn step_named(&mut self, event: Option<&str>) -> &str {
+        let event = event.and_then(|name| self.machine.event_id(name));
+        let state = self.step(event);
+        self.machine.state_name(state)
+    }
+
+    fn apply(action: &CompiledAction, variables: &mut [f64], emitted: &mut Vec<u32>) {
+        for assign in &action.assignments {
+            let slot = &mut variables[assign.slot as usize];
+            match assign.op {
+                AssignmentOp::Set => *slot = assign.value,
+                AssignmentOp::Add => *slot += assign.value,
+                AssignmentOp::Subtract => *slot -= assign.value,
+            }
+        }
+        emitted.extend_from_slice(&action.sends);
+    }
+
+    /// Reset to the initial state, zeroing all variable slots.
+    pub fn reset(&mut self) {
+        self.current = self.machine.initial;
+        self.completed = self.machine.is_final[self.current as usize];
+        self.variables.iter_mut().for_each(|v| *v = 0.0);
+        self.emitted.clear();
+    }
+
+    /// The current state index.
+    pub fn current_state_id(&self) -> u32 {
+        self.current
+    }
+
+    /// The current state name.
+    pub fn current_state_name(&self) -> &str {
+        self.machine.state_name(self.current)
+    }
+
+    /// Whether a final state has been reached.
+    pub fn is_completed(&self) -> bool {
+        self.completed
+    }
+
+    /// The value of a variable slot.
+    pub fn variable(&self, slot: u32) -> f64 {
+        self.variables[slot as usize]
+    }
+
+    /// Set a variable slot (e.g. to seed initial conditions).
+    pub fn set_variable(&mut self, slot: u32, value: f64) {
+        self.variables[slot as usize] = value;
+    }
+
+    /// Events emitted by send actions during the last step.
+    pub fn emitted(&self) -> &[u32] {
+        &self.emitted
+    }
+
+    /// The compiled machine this runner steps over.
+    pub fn machine(&self) -> &'a CompiledStateMachine {
+        self.machine
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::StateMachineRunner;
+    use sysml_run::{ActionIR, AssignmentIR, Runner, StateIR, TransitionIR};
+
+    fn traffic_light() -> StateMachineIR {
+        StateMachineIR::new("TrafficLight", "Red")
+            .with_state(StateIR::new("Red"))
+            .with_state(StateIR::new("Green"))
+            .with_state(StateIR::new("Yellow"))
+            .with_transition(TransitionIR::new("Red", "Green").with_event("timer"))
+            .with_transition(TransitionIR::new("Green", "Yellow").with_event("timer"))
+            .with_transition(TransitionIR::new("Yellow", "Red").with_event("timer"))
+    }
+
+    #[test]
+    fn compiled_matches_interpreter() {
+        let ir = traffic_light();
+        let compiled = CompiledStateMachine::compile(&ir).unwrap();
+
+        let mut interpreted = StateMachineRunner::new(ir);
+        let mut runner = compiled.runner();
+
+        for event in [Some("timer"), Some("timer"), Some("unknown"), None, Some("timer")] {
+            let expected = interpreted.step(event);
+            let actual = runner.step_named(event);
+            assert_eq!(actual, expected.state);
+            assert_eq!(runner.is_completed(), expected.completed);
+        }
+    }
+
+    #[test]
+    fn dense_dispatch_by_event_id() {
+        let ir = traffic_light();
+        let compiled = CompiledStateMachine::compile(&ir).unwrap();
+        assert_eq!(compiled.state_count(), 3);
+        assert_eq!(compiled.event_count(), 1);
+
+        let timer = compiled.event_id("timer").unwrap();
+        let mut runner = compiled.runner();
+        for _ in 0..3_000 {
+            runner.step(Some(timer));
+        }
+        // 3000 steps around a 3-cycle lands back on Red.
+        assert_eq!(runner.current_state_name(), "Red");
+    }
+
+    #[test]
+    fn eventless_transition_matches_any_event() {
+        let ir = StateMachineIR::new("Auto", "a")
+            .with_state(StateIR::new("a"))
+            .with_state(StateIR::new("b"))
+            .with_transition(TransitionIR::new("a", "b"));
+        let compiled = CompiledStateMachine::compile(&ir).unwrap();
+
+        let mut runner = compiled.runner();
+        assert_eq!(runner.step_named(None), "b");
+
+        runner.reset();
+        assert_eq!(runner.step_named(Some("anything")), "b");
+    }
+
+    #[test]
+    fn earlier_eventless_transition_shadows_named() {
+        // The interpreter scans in declaration order, so an event-less
+        // transition declared first wins even for named events.
+        let ir = StateMachineIR::new("Shadow", "a")
+            .with_state(StateIR::new("a"))
+            .with_state(StateIR::new("b"))
+            .with_state(StateIR::new("c"))
+            .with_transition(TransitionIR::new("a", "b"))
+            .with_transition(TransitionIR::new("a", "c").with_event("go"));
+        let compiled = CompiledStateMachine::compile(&ir).unwrap();
+
+        let mut runner = compiled.runner();
+        assert_eq!(runner.step_named(Some("go")), "b");
+    }
+
+    #[test]
+    fn structured_actions_bind_to_slots() {
+        let ir = StateMachineIR::new("Timed", "idle")
+            .with_state(StateIR::new("idle"))
+            .with_state(
+                StateIR::new("active")
+                    .with_entry_action(ActionIR::structured(vec![AssignmentIR::set("mode", 1.0)], vec![])),
+            )
+            .with_transition(
+                TransitionIR::new("idle", "active").with_event("start").with_action_ir(
+                    ActionIR::structured(
+                        vec![AssignmentIR::add("t", 10.0)],
+                        vec!["started".to_string()],
+                    ),
+                ),
+            );
+        let compiled = CompiledStateMachine::compile(&ir).unwrap();
+        let t = compiled.variable_slot("t").unwrap();
+        let mode = compiled.variable_slot("mode").unwrap();
+        let started = compiled.event_id("started").unwrap();
+
+        let mut runner = compiled.runner();
+        runner.set_variable(t, 5.0);
+        runner.step_named(Some("start"));
+
+        assert_eq!(runner.variable(t), 15.0);
+        assert_eq!(runner.variable(mode), 1.0);
+        assert_eq!(runner.emitted(), &[started]);
+    }
+
+    #[test]
+    fn final_state_completes_and_holds() {
+        let ir = StateMachineIR::new("Done", "run")
+            .with_state(StateIR::new("run"))
+            .with_state(StateIR::new("end").final_state())
+            .with_transition(TransitionIR::new("run", "end").with_event("stop"));
+        let compiled = CompiledStateMachine::compile(&ir).unwrap();
+
+        let mut runner = compiled.runner();
+        assert_eq!(runner.step_named(Some("stop")), "end");
+        assert!(runner.is_completed());
+        // Further steps are no-ops.
+        assert_eq!(runner.step_named(Some("stop")), "end");
+    }
+
+    #[test]
+    fn undeclared_transition_targets_are_interned() {
+        // The interpreter tolerates transitions to states never declared;
+        // the compiler interns them as plain states.
+        let ir = StateMachineIR::new("Loose", "a")
+            .with_state(StateIR::new("a"))
+            .with_transition(TransitionIR::new("a", "ghost").with_event("go"));
+        let compiled = CompiledStateMachine::compile(&ir).unwrap();
+
+        let mut runner = compiled.runner();
+        assert_eq!(runner.step_named(Some("go")), "ghost");
+        assert!(!runner.is_completed());
+    }
+
+    #[test]
+    fn parallel_machines_are_rejected()  {
+        let ir = StateMachineIR::parallel("P")
+            .with_region(sysml_run::RegionIR::new("r", "s"));
+        let err = CompiledStateMachine::compile(&ir).unwrap_err();
+        assert!(err[0].message.contains("Parallel"));
+    }
+
+    #[test]
+    fn reset_restores_initial_state_and_variables() {
+        let ir = StateMachineIR::new("R", "a")
+            .with_state(StateIR::new("a"))
+            .with_state(StateIR::new("b"))
+            .with_transition(
+                TransitionIR::new("a", "b").with_event("go").with_action_ir(
+                    ActionIR::structured(vec![AssignmentIR::set("x", 7.0)], vec![]),
+                ),
+            );
+        let compiled = CompiledStateMachine::compile(&ir).unwrap();
+        let x = compiled.variable_slot("x").unwrap();
+
+        let mut runner = compiled.runner();
+        runner.step_named(Some("go"));
+        assert_eq!(runner.variable(x), 7.0);
+
+        runner.reset();
+        assert_eq!(runner.current_state_name(), "a");
+        assert_eq!(runner.variable(x), 0.0);
+    }
+}
@@ -6,11 +6,17 @@
 //! - Compilation from ModelGraph state machines to StateMachineIR
 //! - A simple runner that executes the IR
 //! - Parallel state machine runner for composite state machines with concurrent regions
+//! - A compiled engine that lowers the IR to dense transition tables for
+//!   allocation-free stepping in long simulation campaigns
 
 pub mod action_parser;
+pub mod campaign;
+pub mod compiled;
 pub mod parallel;
 
 pub use action_parser::parse_action;
+pub use campaign::{Campaign, CampaignResults};
+pub use compiled::{CompiledRunner, CompiledStateMachine};
 pub use parallel::ParallelStateMachineRunner;
 
 use sysml_core::{Element, ElementId, ElementKind, ModelGraph, RelationshipKind};
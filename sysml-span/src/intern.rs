@@ -0,0 +1,313 @@
+//! String interning for names, node kinds, and file paths.
+//!
+//! Large models repeat the same short strings millions of times: element
+//! names, kind strings like `"PartUsage"`, property keys, and the file path
+//! carried by every [`Span`](crate::Span). This module provides a
+//! process-wide interner so each unique string is stored once and handled as
+//! a 4-byte id with O(1) equality and hashing.
+//!
+//! Two id types are provided:
+//!
+//! - [`Symbol`]: a general interned string (names, kinds, property keys).
+//! - [`FileId`]: an interned file path or URI. It lives in its own namespace
+//!   so file-path ids stay dense even in models with many distinct names.
+//!
+//! Interned strings live for the lifetime of the process, which is the right
+//! trade-off here: the set of unique names in a model corpus is small and
+//! stable compared to the number of occurrences.
+//!
+//! # Examples
+//!
+//! ```
+//! use sysml_span::{FileId, Symbol};
+//!
+//! let a = Symbol::intern("PartUsage");
+//! let b = Symbol::intern("PartUsage");
+//! assert_eq!(a, b); // O(1) integer comparison
+//! assert_eq!(a.as_str(), "PartUsage");
+//!
+//! let file = FileId::intern("models/vehicle.sysml");
+//! assert_eq!(file.as_str(), "models/vehicle.sysml");
+//! ```
+
+use std::collections::HashMap;
+use std::fmt;
+use std::sync::{OnceLock, RwLock};
+
+#[cfg(feature = "serde")]
+use serde::{Deserialize, Serialize};
+
+/// A thread-safe string interner.
+///
+/// Each unique string is leaked exactly once and addressed by a dense `u32`.
+/// Reads (resolving an id to its string) take a shared lock; interning takes
+/// a shared lock on the hit path and an exclusive lock only for new strings.
+struct Interner {
+    inner: RwLock<InternerInner>,
+}
+
+#[derive(Default)]
+struct InternerInner {
+    map: HashMap<&'static str, u32>,
+    strings: Vec<&'static str>,
+}
+
+impl Interner {
+    fn new() -> Self {
+        Interner {
+            inner: RwLock::new(InternerInner::default()),
+        }
+    }
+
+    fn intern(&self, s: &str) -> u32 {
+        // Fast path: the string is already interned.
+        if let Some(&id) = self.inner.read().unwrap().map.get(s) {
+            return id;
+        }
+        let mut inner = self.inner.write().unwrap();
+        // Re-check under the write lock: another thread may have won the race.
+        if let Some(&id) = inner.map.get(s) {
+            return id;
+        }
+        let leaked: &'static str = Box::leak(s.to_owned().into_boxed_str());
+        let id = inner.strings.len() as u32;
+        inner.strings.push(leaked);
+        inner.map.insert(leaked, id);
+        id
+    }
+
+    fn get(&self, s: &str) -> Option<u32> {
+        self.inner.read().unwrap().map.get(s).copied()
+    }
+
+    fn resolve(&self, id: u32) -> &'static str {
+        self.inner.read().unwrap().strings[id as usize]
+    }
+}
+
+/// The global interner for general symbols (names, kinds, property keys).
+fn symbols() -> &'static Interner {
+    static SYMBOLS: OnceLock<Interner> = OnceLock::new();
+    SYMBOLS.get_or_init(Interner::new)
+}
+
+/// The global interner for file paths.
+fn files() -> &'static Interner {
+    static FILES: OnceLock<Interner> = OnceLock::new();
+    FILES.get_or_init(Interner::new)
+}
+
+/// An interned string: a 4-byte handle with O(1) equality and hashing.
+///
+/// Use for element names, node kinds, property keys, and other short strings
+/// that repeat heavily across a model.
+///
+/// # Examples
+///
+/// ```
+/// use sysml_span::Symbol;
+///
+/// let name = Symbol::intern("Vehicle");
+/// assert_eq!(name, "Vehicle");
+/// assert_eq!(name.to_string(), "Vehicle");
+/// ```
+#[derive(Debug, Clone, Copy, PartialEq, Eq, PartialOrd, Ord, Hash)]
+pub struct Symbol(u32);
+
+impl Symbol {
+    /// Intern a string, returning its symbol.
+    ///
+    /// The same input always returns the same symbol for the lifetime of
+    /// the process.
+    pub fn intern(s: &str) -> Self {
+        Symbol(symbols().intern(s))
+    }
+
+    /// Look up the symbol for a string without interning it.
+    ///
+    /// Returns `None` if the string has never been interned. Useful on
+    /// lookup paths where a miss should not grow the interner.
+    pub fn get(s: &str) -> Option<Self> {
+        symbols().get(s).map(Symbol)
+    }
+
+    /// The interned string.
+    pub fn as_str(self) -> &'static str {
+        symbols().resolve(self.0)
+    }
+}
+
+impl fmt::Display for Symbol {
+    fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
+        f.write_str(self.as_str())
+    }
+}
+
+impl From<&str> for Symbol {
+    fn from(s: &str) -> Self {
+        Symbol::intern(s)
+    }
+}
+
+impl From<&String> for Symbol {
+    fn from(s: &String) -> Self {
+        Symbol::intern(s)
+    }
+}
+
+impl From<String> for Symbol {
+    fn from(s: String) -> Self {
+        Symbol::intern(&s)
+    }
+}
+
+impl PartialEq<str> for Symbol {
+    fn eq(&self, other: &str) -> bool {
+        self.as_str() == other
+    }
+}
+
+impl PartialEq<&str> for Symbol {
+    fn eq(&self, other: &&str) -> bool {
+        self.as_str() == *other
+    }
+}
+
+impl PartialEq<Symbol> for str {
+    fn eq(&self, other: &Symbol) -> bool {
+        self == other.as_str()
+    }
+}
+
+impl PartialEq<Symbol> for &str {
+    fn eq(&self, other: &Symbol) -> bool {
+        *self == other.as_str()
+    }
+}
+
+#[cfg(feature = "serde")]
+impl Serialize for Symbol {
+    fn serialize<S: serde::Serializer>(&self, serializer: S) -> Result<S::Ok, S::Error> {
+        serializer.serialize_str(self.as_str())
+    }
+}
+
+#[cfg(feature = "serde")]
+impl<'de> Deserialize<'de> for Symbol {
+    fn deserialize<D: serde::Deserializer<'de>>(deserializer: D) -> Result<Self, D::Error> {
+        let s = String::deserialize(deserializer)?;
+        Ok(Symbol::intern(&s))
+    }
+}
+
+/// An interned file path or URI.
+///
+/// Distinct from [`Symbol`] so that file ids form their own dense namespace;
+/// a workspace with a few thousand files gets ids that fit comfortably in
+/// small per-file tables regardless of how many element names are interned.
+///
+/// # Examples
+///
+/// ```
+/// use sysml_span::FileId;
+///
+/// let a = FileId::intern("pkg/model.sysml");
+/// let b = FileId::intern("pkg/model.sysml");
+/// assert_eq!(a, b);
+/// ```
+#[derive(Debug, Clone, Copy, PartialEq, Eq, PartialOrd, Ord, Hash)]
+pub struct FileId(u32);
+
+impl FileId {
+    /// Intern a file path, returning its id.
+    pub fn intern(path: &str) -> Self {
+        FileId(files().intern(path))
+    }
+
+    /// The interned file path.
+    pub fn as_str(self) -> &'static str {
+        files().resolve(self.0)
+    }
+}
+
+impl fmt::Display for FileId {
+    fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
+        f.write_str(self.as_str())
+    }
+}
+
+impl From<&str> for FileId {
+    fn from(s: &str) -> Self {
+        FileId::intern(s)
+    }
+}
+
+#[cfg(feature = "serde")]
+impl Serialize for FileId {
+    fn serialize<S: serde::Serializer>(&self, serializer: S) -> Result<S::Ok, S::Error> {
+        serializer.serialize_str(self.as_str())
+    }
+}
+
+#[cfg(feature = "serde")]
+impl<'de> Deserialize<'de> for FileId {
+    fn deserialize<D: serde::Deserializer<'de>>(deserializer: D) -> Result<Self, D::Error> {
+        let s = String::deserialize(deserializer)?;
+        Ok(FileId::intern(&s))
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn interning_is_idempotent() {
+        let a = Symbol::intern("Package");
+        let b = Symbol::intern("Package");
+        let c = Symbol::intern("PartUsage");
+        assert_eq!(a, b);
+        assert_ne!(a, c);
+        assert_eq!(a.as_str(), "Package");
+    }
+
+    #[test]
+    fn symbol_compares_with_str() {
+        let sym = Symbol::intern("identifier");
+        assert_eq!(sym, "identifier");
+        assert_eq!("identifier", sym);
+        assert!(sym != "other");
+    }
+
+    #[test]
+    fn file_ids_are_a_separate_namespace() {
+        // The same text interned as a symbol and as a file path must not
+        // collide observably; both resolve back to the original string.
+        let sym = Symbol::intern("a.sysml");
+        let file = FileId::intern("a.sysml");
+        assert_eq!(sym.as_str(), file.as_str());
+    }
+
+    #[test]
+    fn display_renders_the_string() {
+        assert_eq!(Symbol::intern("x").to_string(), "x");
+        assert_eq!(FileId::intern("f.sysml").to_string(), "f.sysml");
+    }
+
+    #[test]
+    fn concurrent_interning() {
+        let handles: Vec<_> = (0..8)
+            .map(|_| {
+                std::thread::spawn(|| {
+                    (0..100)
+                        .map(|i| Symbol::intern(&format!("name{}", i)))
+                        .collect::<Vec<_>>()
+                })
+            })
+            .collect();
+        let results: Vec<Vec<Symbol>> = handles.into_iter().map(|h| h.join().unwrap()).collect();
+        for w in results.windows(2) {
+            assert_eq!(w[0], w[1]);
+        }
+    }
+}
@@ -36,6 +36,9 @@ mod pretty;
 #[cfg(feature = "pretty")]
 pub use pretty::{DiagnosticRenderer, HashMapSourceProvider, SourceProvider};
 
+mod intern;
+pub use intern::{FileId, Symbol};
+
 /// A span representing a range in a source file.
 ///
 /// # Examples
@@ -153,6 +156,24 @@ impl Span {
         }
     }
 
+    /// Get the interned [`FileId`] for this span's file path.
+    ///
+    /// Repeated calls for spans in the same file return the same 4-byte id,
+    /// which is cheaper to store, hash, and compare than the path string.
+    ///
+    /// # Examples
+    ///
+    /// ```
+    /// use sysml_span::Span;
+    ///
+    /// let a = Span::new("file.sysml", 0, 5);
+    /// let b = Span::new("file.sysml", 5, 9);
+    /// assert_eq!(a.file_id(), b.file_id());
+    /// ```
+    pub fn file_id(&self) -> FileId {
+        FileId::intern(&self.file)
+    }
+
     /// Get the length of this span in bytes.
     ///
     /// # Examples
@@ -884,6 +905,53 @@ impl LineIndex {
     pub fn line_count(&self) -> usize {
         self.line_offsets.len()
     }
+
+    /// Get the byte offset where a line starts. Lines are 1-indexed to
+    /// match [`LineIndex::line_col`]; returns None past the last line.
+    pub fn line_start(&self, line: u32) -> Option<usize> {
+        self.line_offsets.get((line as usize).checked_sub(1)?).copied()
+    }
+
+    /// Patch the index after replacing `start..old_end` with `new_text`.
+    ///
+    /// Line starts inside the replaced region are dropped, the new text's
+    /// line starts are spliced in, and everything after the edit is
+    /// shifted — O(changed region + tail move) instead of rescanning the
+    /// whole file. The result is identical to rebuilding with
+    /// [`LineIndex::new`] on the edited source.
+    ///
+    /// # Examples
+    ///
+    /// ```
+    /// use sysml_span::LineIndex;
+    ///
+    /// let mut index = LineIndex::new("aa\nbb\ncc");
+    /// // Replace "bb" with "x\ny".
+    /// index.edit(3, 5, "x\ny");
+    /// assert_eq!(index.line_count(), LineIndex::new("aa\nx\ny\ncc").line_count());
+    /// ```
+    pub fn edit(&mut self, start: usize, old_end: usize, new_text: &str) {
+        let new_end = start + new_text.len();
+        let delta = new_end as isize - old_end as isize;
+
+        // A line start at offset o comes from a '\n' at o - 1, so starts in
+        // (start, old_end] came from newlines inside the replaced region.
+        let keep = self.line_offsets.partition_point(|&o| o <= start);
+        let resume = self.line_offsets.partition_point(|&o| o <= old_end);
+
+        let tail: Vec<usize> = self.line_offsets[resume..]
+            .iter()
+            .map(|&o| (o as isize + delta) as usize)
+            .collect();
+
+        self.line_offsets.truncate(keep);
+        for (i, c) in new_text.char_indices() {
+            if c == '\n' {
+                self.line_offsets.push(start + i + 1);
+            }
+        }
+        self.line_offsets.extend(tail);
+    }
 }
 
 #[cfg(test)]
@@ -1034,4 +1102,49 @@ mod tests {
         // Line 3: "b"
         assert_eq!(index.line_col(3), (3, 1)); // 'b'
     }
+
+    #[test]
+    fn line_index_line_start() {
+        let index = LineIndex::new("line 1\nline 2\nline 3");
+        assert_eq!(index.line_start(1), Some(0));
+        assert_eq!(index.line_start(2), Some(7));
+        assert_eq!(index.line_start(3), Some(14));
+        assert_eq!(index.line_start(4), None);
+        assert_eq!(index.line_start(0), None);
+    }
+
+    /// Apply an edit both incrementally and by rescan and compare.
+    fn check_edit(source: &str, start: usize, old_end: usize, new_text: &str) {
+        let mut incremental = LineIndex::new(source);
+        incremental.edit(start, old_end, new_text);
+
+        let mut edited = source.to_string();
+        edited.replace_range(start..old_end, new_text);
+        let rescanned = LineIndex::new(&edited);
+
+        assert_eq!(
+            incremental.line_offsets, rescanned.line_offsets,
+            "edit {}..{} -> {:?} on {:?}",
+            start, old_end, new_text, source
+        );
+    }
+
+    #[test]
+    fn line_index_edit_matches_rescan() {
+        let source = "line 1\nline 2\nline 3\n";
+        // Single-line replacement.
+        check_edit(source, 7, 13, "changed");
+        // Replacement that removes a newline.
+        check_edit(source, 5, 8, " ");
+        // Replacement that adds newlines.
+        check_edit(source, 7, 13, "a\nb\nc");
+        // Insertion at start, middle, end.
+        check_edit(source, 0, 0, "new first\n");
+        check_edit(source, 10, 10, "\n");
+        check_edit(source, source.len(), source.len(), "line 4");
+        // Delete everything.
+        check_edit(source, 0, source.len(), "");
+        // Edit on empty source.
+        check_edit("", 0, 0, "a\nb");
+    }
 }
@@ -17,12 +17,22 @@ pub use sysml_store::InMemoryStore;
 #[cfg(feature = "postgres")]
 mod postgres_impl {
     use super::*;
-    use sysml_canon::{from_json_str, to_json_string};
-    use sysml_core::ModelGraph;
+    use sqlx::postgres::{PgPool, PgPoolOptions};
+    use sysml_canon::to_json_string;
+    use sysml_core::{Element, GraphBuilder, ModelGraph, Relationship};
     use sysml_id::{CommitId, ProjectId};
-    use sqlx::postgres::PgPool;
+
+    /// Rows per batched UNNEST insert when ingesting element tables.
+    const INGEST_BATCH_SIZE: usize = 1000;
 
     /// PostgreSQL-backed store.
+    ///
+    /// Commits are written both as a whole-model JSONB blob (the format the
+    /// original schema used, kept for compatibility) and as per-element /
+    /// per-relationship rows ingested in batches, so hot reads and
+    /// server-side filters never have to load and parse the full model.
+    /// All queries go through sqlx's per-connection prepared-statement
+    /// cache, so the hot paths plan once per connection.
     pub struct PostgresStore {
         pool: PgPool,
     }
@@ -37,6 +47,24 @@ mod postgres_impl {
             Ok(PostgresStore { pool })
         }
 
+        /// Create a store with a bounded connection pool.
+        ///
+        /// Use this for write bursts: [`PostgresStore::put_snapshots_concurrent`]
+        /// fans commits out across the pool, so `max_connections` caps the
+        /// parallelism.
+        pub async fn with_pool_size(
+            database_url: &str,
+            max_connections: u32,
+        ) -> Result<Self, StoreError> {
+            let pool = PgPoolOptions::new()
+                .max_connections(max_connections)
+                .connect(database_url)
+                .await
+                .map_err(|e| StoreError::DatabaseError(e.to_string()))?;
+
+            Ok(PostgresStore { pool })
+        }
+
         /// Initialize the database schema.
         pub async fn init_schema(&self) -> Result<(), StoreError> {
             sqlx::query(
@@ -66,17 +94,114 @@ mod postgres_impl {
             .await
             .map_err(|e| StoreError::DatabaseError(e.to_string()))?;
 
+            sqlx::query(
+                r#"
+                CREATE TABLE IF NOT EXISTS model_elements (
+                    project_id TEXT NOT NULL,
+                    commit_id TEXT NOT NULL,
+                    element_id TEXT NOT NULL,
+                    name TEXT,
+                    kind TEXT NOT NULL,
+                    data JSONB NOT NULL,
+                    PRIMARY KEY (project_id, commit_id, element_id)
+                )
+                "#,
+            )
+            .execute(&self.pool)
+            .await
+            .map_err(|e| StoreError::DatabaseError(e.to_string()))?;
+
+            sqlx::query(
+                r#"
+                CREATE TABLE IF NOT EXISTS model_relationships (
+                    project_id TEXT NOT NULL,
+                    commit_id TEXT NOT NULL,
+                    relationship_id TEXT NOT NULL,
+                    kind TEXT NOT NULL,
+                    source_id TEXT NOT NULL,
+                    target_id TEXT NOT NULL,
+                    data JSONB NOT NULL,
+                    PRIMARY KEY (project_id, commit_id, relationship_id)
+                )
+                "#,
+            )
+            .execute(&self.pool)
+            .await
+            .map_err(|e| StoreError::DatabaseError(e.to_string()))?;
+
+            // Server-side filtering for find_by_name-style queries.
+            sqlx::query(
+                r#"
+                CREATE INDEX IF NOT EXISTS idx_model_elements_name
+                ON model_elements (project_id, commit_id, name)
+                "#,
+            )
+            .execute(&self.pool)
+            .await
+            .map_err(|e| StoreError::DatabaseError(e.to_string()))?;
+
+            sqlx::query(
+                r#"
+                CREATE INDEX IF NOT EXISTS idx_model_elements_kind
+                ON model_elements (project_id, commit_id, kind)
+                "#,
+            )
+            .execute(&self.pool)
+            .await
+            .map_err(|e| StoreError::DatabaseError(e.to_string()))?;
+
             Ok(())
         }
 
         /// Store a snapshot asynchronously.
+        ///
+        /// Writes the whole-model blob plus the per-element and
+        /// per-relationship rows in one transaction, batching the row
+        /// ingestion [`INGEST_BATCH_SIZE`] records at a time.
         pub async fn put_snapshot_async(
             &self,
             project: &ProjectId,
             meta: SnapshotMeta,
             graph: &ModelGraph,
         ) -> Result<(), StoreError> {
-            let data = to_json_string(graph);
+            Self::write_snapshot(&self.pool, project.clone(), meta, graph.clone()).await
+        }
+
+        /// Store several commits concurrently across the connection pool.
+        ///
+        /// Each commit is written in its own transaction on its own pooled
+        /// connection, so a CI burst of N repos saturates `max_connections`
+        /// instead of a single connection. Fails on the first error; commits
+        /// already written stay written (each commit is independent).
+        pub async fn put_snapshots_concurrent(
+            &self,
+            writes: Vec<(ProjectId, SnapshotMeta, ModelGraph)>,
+        ) -> Result<(), StoreError> {
+            let mut tasks = tokio::task::JoinSet::new();
+            for (project, meta, graph) in writes {
+                let pool = self.pool.clone();
+                tasks.spawn(async move { Self::write_snapshot(&pool, project, meta, graph).await });
+            }
+
+            while let Some(joined) = tasks.join_next().await {
+                joined.map_err(|e| StoreError::DatabaseError(e.to_string()))??;
+            }
+            Ok(())
+        }
+
+        /// Write one commit (blob row plus element tables) transactionally.
+        async fn write_snapshot(
+            pool: &PgPool,
+            project: ProjectId,
+            meta: SnapshotMeta,
+            graph: ModelGraph,
+        ) -> Result<(), StoreError> {
+            let data = to_json_string(&graph);
+
+            let mut tx = pool
+                .begin()
+                .await
+                .map_err(|e| StoreError::DatabaseError(e.to_string()))?;
 
             sqlx::query(
                 r#"
@@ -90,7 +215,7 @@ mod postgres_impl {
             .bind(&meta.message)
             .bind(meta.timestamp as i64)
             .bind(&data)
-            .execute(&self.pool)
+            .execute(&mut *tx)
             .await
             .map_err(|e| {
                 if e.to_string().contains("duplicate key") {
@@ -100,7 +225,206 @@ mod postgres_impl {
                 }
             })?;
 
-            Ok(())
+            let elements: Vec<&Element> = graph.elements.values().collect();
+            for batch in elements.chunks(INGEST_BATCH_SIZE) {
+                let mut ids = Vec::with_capacity(batch.len());
+                let mut names: Vec<Option<String>> = Vec::with_capacity(batch.len());
+                let mut kinds = Vec::with_capacity(batch.len());
+                let mut payloads = Vec::with_capacity(batch.len());
+                for element in batch {
+                    ids.push(element.id.as_str().to_string());
+                    names.push(element.name.clone());
+                    kinds.push(element.kind.to_string());
+                    payloads.push(
+                        serde_json::to_string(element)
+                            .map_err(|e| StoreError::SerializationError(e.to_string()))?,
+                    );
+                }
+
+                sqlx::query(
+                    r#"
+                    INSERT INTO model_elements (project_id, commit_id, element_id, name, kind, data)
+                    SELECT $1, $2, r.id, r.name, r.kind, r.data::jsonb
+                    FROM UNNEST($3::text[], $4::text[], $5::text[], $6::text[])
+                        AS r(id, name, kind, data)
+                    "#,
+                )
+                .bind(project.as_str())
+                .bind(meta.commit.as_str())
+                .bind(&ids)
+                .bind(&names)
+                .bind(&kinds)
+                .bind(&payloads)
+                .execute(&mut *tx)
+                .await
+                .map_err(|e| StoreError::DatabaseError(e.to_string()))?;
+            }
+
+            let relationships: Vec<&Relationship> = graph.relationships.values().collect();
+            for batch in relationships.chunks(INGEST_BATCH_SIZE) {
+                let mut ids = Vec::with_capacity(batch.len());
+                let mut kinds = Vec::with_capacity(batch.len());
+                let mut sources = Vec::with_capacity(batch.len());
+                let mut targets = Vec::with_capacity(batch.len());
+                let mut payloads = Vec::with_capacity(batch.len());
+                for relationship in batch {
+                    ids.push(relationship.id.as_str().to_string());
+                    kinds.push(relationship.kind.to_string());
+                    sources.push(relationship.source.as_str().to_string());
+                    targets.push(relationship.target.as_str().to_string());
+                    payloads.push(
+                        serde_json::to_string(relationship)
+                            .map_err(|e| StoreError::SerializationError(e.to_string()))?,
+                    );
+                }
+
+                sqlx::query(
+                    r#"
+                    INSERT INTO model_relationships
+                        (project_id, commit_id, relationship_id, kind, source_id, target_id, data)
+                    SELECT $1, $2, r.id, r.kind, r.source, r.target, r.data::jsonb
+                    FROM UNNEST($3::text[], $4::text[], $5::text[], $6::text[], $7::text[])
+                        AS r(id, kind, source, target, data)
+                    "#,
+                )
+                .bind(project.as_str())
+                .bind(meta.commit.as_str())
+                .bind(&ids)
+                .bind(&kinds)
+                .bind(&sources)
+                .bind(&targets)
+                .bind(&payloads)
+                .execute(&mut *tx)
+                .await
+                .map_err(|e| StoreError::DatabaseError(e.to_string()))?;
+            }
+
+            tx.commit()
+                .await
+                .map_err(|e| StoreError::DatabaseError(e.to_string()))
+        }
+
+        /// Reconstruct a model from its element tables.
+        ///
+        /// Reads the per-element rows written by the batched ingest path and
+        /// feeds them straight into the `GraphBuilder` bulk-load path,
+        /// skipping the whole-model blob entirely. Falls back to the blob
+        /// for commits written before the element tables existed.
+        pub async fn get_model_async(
+            &self,
+            project: &ProjectId,
+            commit: &CommitId,
+        ) -> Result<Option<ModelGraph>, StoreError> {
+            let element_rows: Vec<(String,)> = sqlx::query_as(
+                r#"
+                SELECT data::text
+                FROM model_elements
+                WHERE project_id = $1 AND commit_id = $2
+                "#,
+            )
+            .bind(project.as_str())
+            .bind(commit.as_str())
+            .fetch_all(&self.pool)
+            .await
+            .map_err(|e| StoreError::DatabaseError(e.to_string()))?;
+
+            if element_rows.is_empty() {
+                return match self.get_snapshot_async(project, commit).await? {
+                    Some(snapshot) => snapshot.graph().map(Some),
+                    None => Ok(None),
+                };
+            }
+
+            let relationship_rows: Vec<(String,)> = sqlx::query_as(
+                r#"
+                SELECT data::text
+                FROM model_relationships
+                WHERE project_id = $1 AND commit_id = $2
+                "#,
+            )
+            .bind(project.as_str())
+            .bind(commit.as_str())
+            .fetch_all(&self.pool)
+            .await
+            .map_err(|e| StoreError::DatabaseError(e.to_string()))?;
+
+            let mut builder =
+                GraphBuilder::with_capacity(element_rows.len(), relationship_rows.len());
+            for (payload,) in &element_rows {
+                let element: Element = serde_json::from_str(payload)
+                    .map_err(|e| StoreError::DeserializationError(e.to_string()))?;
+                builder.add_element(element);
+            }
+            for (payload,) in &relationship_rows {
+                let relationship: Relationship = serde_json::from_str(payload)
+                    .map_err(|e| StoreError::DeserializationError(e.to_string()))?;
+                builder.add_relationship(relationship);
+            }
+            Ok(Some(builder.build()))
+        }
+
+        /// Find elements by exact name without loading the whole model.
+        ///
+        /// Runs as indexed SQL against `model_elements`; only the matching
+        /// rows are transferred and deserialized.
+        pub async fn find_by_name_async(
+            &self,
+            project: &ProjectId,
+            commit: &CommitId,
+            name: &str,
+        ) -> Result<Vec<Element>, StoreError> {
+            let rows: Vec<(String,)> = sqlx::query_as(
+                r#"
+                SELECT data::text
+                FROM model_elements
+                WHERE project_id = $1 AND commit_id = $2 AND name = $3
+                ORDER BY element_id
+                "#,
+            )
+            .bind(project.as_str())
+            .bind(commit.as_str())
+            .bind(name)
+            .fetch_all(&self.pool)
+            .await
+            .map_err(|e| StoreError::DatabaseError(e.to_string()))?;
+
+            rows.iter()
+                .map(|(payload,)| {
+                    serde_json::from_str(payload)
+                        .map_err(|e| StoreError::DeserializationError(e.to_string()))
+                })
+                .collect()
+        }
+
+        /// List all commits for a project, most recent first.
+        pub async fn list_commits_async(
+            &self,
+            project: &ProjectId,
+        ) -> Result<Vec<SnapshotMeta>, StoreError> {
+            let rows: Vec<(String, Option<String>, String, i64)> = sqlx::query_as(
+                r#"
+                SELECT commit_id, parent_id, message, timestamp
+                FROM snapshots
+                WHERE project_id = $1
+                ORDER BY timestamp DESC
+                "#,
+            )
+            .bind(project.as_str())
+            .fetch_all(&self.pool)
+            .await
+            .map_err(|e| StoreError::DatabaseError(e.to_string()))?;
+
+            Ok(rows
+                .into_iter()
+                .map(|(commit_id, parent_id, message, timestamp)| {
+                    let mut meta = SnapshotMeta::new(CommitId::new(commit_id), message)
+                        .with_timestamp(timestamp as u64);
+                    if let Some(parent) = parent_id {
+                        meta = meta.with_parent(CommitId::new(parent));
+                    }
+                    meta
+                })
+                .collect())
         }
 
         /// Get a snapshot asynchronously.
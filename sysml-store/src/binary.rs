@@ -0,0 +1,534 @@
+//! Binary snapshot format with memory-mapped, zero-copy loading.
+//!
+//! JSON snapshots re-parse the whole graph on every read. The binary format
+//! here stores length-prefixed element/relationship tables with an offset
+//! index, so a snapshot can be opened by memory-mapping the file and only
+//! the records a request touches are ever decoded:
+//!
+//! ```text
+//! [magic "SYSB"][version u32][element_count u32][relationship_count u32]
+//! [element offsets: element_count x u64]
+//! [relationship offsets: relationship_count x u64]
+//! [records: [id_len u16][id utf8][payload_len u32][payload]]
+//! ```
+//!
+//! All integers are little-endian. Records are ordered by id (the canonical
+//! order used by `sysml-canon`), so point lookups binary-search the offset
+//! table and decode a single record. Payloads are the serde encoding of
+//! `Element`/`Relationship`, which keeps the format in lockstep with the
+//! model types.
+
+use std::fs::File;
+use std::path::{Path, PathBuf};
+
+use sysml_core::{Element, GraphBuilder, ModelGraph, Relationship};
+use sysml_id::{CommitId, ElementId, ProjectId};
+
+use crate::{Snapshot, SnapshotMeta, Store, StoreError};
+
+/// Magic bytes identifying a binary snapshot file.
+pub const BINARY_MAGIC: &[u8; 4] = b"SYSB";
+
+/// Version of the binary snapshot layout.
+pub const BINARY_FORMAT_VERSION: u32 = 1;
+
+/// Size of the fixed header (magic + version + two counts).
+const HEADER_LEN: usize = 16;
+
+/// Backing storage for a binary snapshot: either an owned buffer or a
+/// memory-mapped file.
+#[derive(Debug)]
+enum BinaryData {
+    Owned(Vec<u8>),
+    Mapped(memmap2::Mmap),
+}
+
+impl BinaryData {
+    fn bytes(&self) -> &[u8] {
+        match self {
+            BinaryData::Owned(bytes) => bytes,
+            BinaryData::Mapped(map) => map,
+        }
+    }
+}
+
+/// A binary model snapshot, readable without a full deserialize.
+///
+/// Open one with [`BinarySnapshot::open`] (memory-mapped) or
+/// [`BinarySnapshot::from_bytes`], then materialize only what a request
+/// touches via [`get_element`](Self::get_element) /
+/// [`get_relationship`](Self::get_relationship), or the whole graph with
+/// [`graph`](Self::graph).
+#[derive(Debug)]
+pub struct BinarySnapshot {
+    data: BinaryData,
+    element_count: usize,
+    relationship_count: usize,
+    /// Byte offset of the element offset table.
+    element_table: usize,
+    /// Byte offset of the relationship offset table.
+    relationship_table: usize,
+}
+
+/// Encode a graph into the binary snapshot format.
+pub fn encode_graph(graph: &ModelGraph) -> Result<Vec<u8>, StoreError> {
+    let element_count = graph.element_count();
+    let relationship_count = graph.relationship_count();
+    let tables_len = (element_count + relationship_count) * 8;
+
+    let mut offsets: Vec<u64> = Vec::with_capacity(element_count + relationship_count);
+    let mut records: Vec<u8> = Vec::new();
+    let records_base = HEADER_LEN + tables_len;
+
+    let mut push_record = |id: &str, payload: Vec<u8>, records: &mut Vec<u8>| {
+        offsets.push((records_base + records.len()) as u64);
+        records.extend_from_slice(&(id.len() as u16).to_le_bytes());
+        records.extend_from_slice(id.as_bytes());
+        records.extend_from_slice(&(payload.len() as u32).to_le_bytes());
+        records.extend_from_slice(&payload);
+    };
+
+    // BTreeMap iteration gives canonical id order, which the point-lookup
+    // binary search relies on.
+    for (id, element) in graph.elements.iter() {
+        let payload = serde_json::to_vec(element)
+            .map_err(|e| StoreError::SerializationError(e.to_string()))?;
+        push_record(&id.as_str(), payload, &mut records);
+    }
+    for (id, relationship) in graph.relationships.iter() {
+        let payload = serde_json::to_vec(relationship)
+            .map_err(|e| StoreError::SerializationError(e.to_string()))?;
+        push_record(&id.as_str(), payload, &mut records);
+    }
+
+    let mut out = Vec::with_capacity(records_base + records.len());
+    out.extend_from_slice(BINARY_MAGIC);
+    out.extend_from_slice(&BINARY_FORMAT_VERSION.to_le_bytes());
+    out.extend_from_slice(&(element_count as u32).to_le_bytes());
+    out.extend_from_slice(&(relationship_count as u32).to_le_bytes());
+    for offset in &offsets {
+        out.extend_from_slice(&offset.to_le_bytes());
+    }
+    out.extend_from_slice(&records);
+    Ok(out)
+}
+
+impl BinarySnapshot {
+    /// Open a binary snapshot by memory-mapping a file.
+    ///
+    /// Nothing is decoded up front; the file's pages are faulted in as
+    /// records are accessed.
+    pub fn open(path: impl AsRef<Path>) -> Result<Self, StoreError> {
+        let file = File::open(path).map_err(|e| StoreError::DatabaseError(e.to_string()))?;
+        // Safety: the map is read-only and the store never rewrites a
+        // snapshot file in place (commits are immutable).
+        let map = unsafe { memmap2::Mmap::map(&file) }
+            .map_err(|e| StoreError::DatabaseError(e.to_string()))?;
+        Self::from_data(BinaryData::Mapped(map))
+    }
+
+    /// Open a binary snapshot over an owned buffer.
+    pub fn from_bytes(bytes: Vec<u8>) -> Result<Self, StoreError> {
+        Self::from_data(BinaryData::Owned(bytes))
+    }
+
+    fn from_data(data: BinaryData) -> Result<Self, StoreError> {
+        let bytes = data.bytes();
+        if bytes.len() < HEADER_LEN || &bytes[0..4] != BINARY_MAGIC {
+            return Err(StoreError::DeserializationError(
+                "not a binary snapshot (bad magic)".to_string(),
+            ));
+        }
+        let version = u32::from_le_bytes(bytes[4..8].try_into().unwrap());
+        if version != BINARY_FORMAT_VERSION {
+            return Err(StoreError::DeserializationError(format!(
+                "unsupported binary snapshot version {}",
+                version
+            )));
+        }
+        let element_count = u32::from_le_bytes(bytes[8..12].try_into().unwrap()) as usize;
+        let relationship_count = u32::from_le_bytes(bytes[12..16].try_into().unwrap()) as usize;
+
+        let element_table = HEADER_LEN;
+        let relationship_table = element_table + element_count * 8;
+        if relationship_table + relationship_count * 8 > bytes.len() {
+            return Err(StoreError::DeserializationError(
+                "binary snapshot truncated (offset tables)".to_string(),
+            ));
+        }
+
+        Ok(BinarySnapshot {
+            data,
+            element_count,
+            relationship_count,
+            element_table,
+            relationship_table,
+        })
+    }
+
+    /// The number of elements in the snapshot.
+    pub fn element_count(&self) -> usize {
+        self.element_count
+    }
+
+    /// The number of relationships in the snapshot.
+    pub fn relationship_count(&self) -> usize {
+        self.relationship_count
+    }
+
+    /// Read the record offset at position `index` of a table.
+    fn offset_at(&self, table: usize, index: usize) -> usize {
+        let start = table + index * 8;
+        let bytes = self.data.bytes();
+        u64::from_le_bytes(bytes[start..start + 8].try_into().unwrap()) as usize
+    }
+
+    /// Read the record at a byte offset: (id, payload).
+    fn record_at(&self, offset: usize) -> Result<(&str, &[u8]), StoreError> {
+        let bytes = self.data.bytes();
+        let truncated = || StoreError::DeserializationError("binary snapshot truncated".to_string());
+
+        if offset + 2 > bytes.len() {
+            return Err(truncated());
+        }
+        let id_len = u16::from_le_bytes(bytes[offset..offset + 2].try_into().unwrap()) as usize;
+        let id_start = offset + 2;
+        let payload_len_start = id_start + id_len;
+        if payload_len_start + 4 > bytes.len() {
+            return Err(truncated());
+        }
+        let id = std::str::from_utf8(&bytes[id_start..payload_len_start])
+            .map_err(|e| StoreError::DeserializationError(e.to_string()))?;
+        let payload_len = u32::from_le_bytes(
+            bytes[payload_len_start..payload_len_start + 4].try_into().unwrap(),
+        ) as usize;
+        let payload_start = payload_len_start + 4;
+        if payload_start + payload_len > bytes.len() {
+            return Err(truncated());
+        }
+        Ok((id, &bytes[payload_start..payload_start + payload_len]))
+    }
+
+    /// Binary-search a table for an id, decoding only the probed ids.
+    fn find_in_table(
+        &self,
+        table: usize,
+        count: usize,
+        id: &str,
+    ) -> Result<Option<&[u8]>, StoreError> {
+        let mut low = 0usize;
+        let mut high = count;
+        while low < high {
+            let mid = low + (high - low) / 2;
+            let (record_id, payload) = self.record_at(self.offset_at(table, mid))?;
+            match record_id.cmp(id) {
+                std::cmp::Ordering::Equal => return Ok(Some(payload)),
+                std::cmp::Ordering::Less => low = mid + 1,
+                std::cmp::Ordering::Greater => high = mid,
+            }
+        }
+        Ok(None)
+    }
+
+    /// Materialize a single element by id, decoding only its record.
+    pub fn get_element(&self, id: &ElementId) -> Result<Option<Element>, StoreError> {
+        match self.find_in_table(self.element_table, self.element_count, &id.as_str())? {
+            Some(payload) => serde_json::from_slice(payload)
+                .map(Some)
+                .map_err(|e| StoreError::DeserializationError(e.to_string())),
+            None => Ok(None),
+        }
+    }
+
+    /// Materialize a single relationship by id, decoding only its record.
+    pub fn get_relationship(&self, id: &ElementId) -> Result<Option<Relationship>, StoreError> {
+        match self.find_in_table(
+            self.relationship_table,
+            self.relationship_count,
+            &id.as_str(),
+        )? {
+            Some(payload) => serde_json::from_slice(payload)
+                .map(Some)
+                .map_err(|e| StoreError::DeserializationError(e.to_string())),
+            None => Ok(None),
+        }
+    }
+
+    /// Iterate the element ids without decoding any payloads.
+    pub fn element_ids(&self) -> impl Iterator<Item = &str> {
+        (0..self.element_count).filter_map(move |i| {
+            self.record_at(self.offset_at(self.element_table, i))
+                .ok()
+                .map(|(id, _)| id)
+        })
+    }
+
+    /// Materialize the full graph (bulk-loads via `GraphBuilder`).
+    pub fn graph(&self) -> Result<ModelGraph, StoreError> {
+        let mut builder =
+            GraphBuilder::with_capacity(self.element_count, self.relationship_count);
+        for i in 0..self.element_count {
+            let (_, payload) = self.record_at(self.offset_at(self.element_table, i))?;
+            let element: Element = serde_json::from_slice(payload)
+                .map_err(|e| StoreError::DeserializationError(e.to_string()))?;
+            builder.add_element(element);
+        }
+        for i in 0..self.relationship_count {
+            let (_, payload) = self.record_at(self.offset_at(self.relationship_table, i))?;
+            let relationship: Relationship = serde_json::from_slice(payload)
+                .map_err(|e| StoreError::DeserializationError(e.to_string()))?;
+            builder.add_relationship(relationship);
+        }
+        Ok(builder.build())
+    }
+}
+
+/// On-disk metadata index for one project of a [`FileStore`].
+#[derive(Debug, Default, serde::Serialize, serde::Deserialize)]
+struct ProjectIndex {
+    commits: Vec<SnapshotMeta>,
+}
+
+/// A file-backed store writing binary snapshots.
+///
+/// Layout: `<root>/<project>/<commit>.sysb` per snapshot plus a
+/// `commits.json` metadata index per project. Beyond the [`Store`] trait,
+/// [`FileStore::open_snapshot`] opens a commit by memory-mapping its file,
+/// so callers can materialize only the elements a request touches.
+#[derive(Debug)]
+pub struct FileStore {
+    root: PathBuf,
+}
+
+impl FileStore {
+    /// Create a store rooted at a directory (created if missing).
+    pub fn new(root: impl Into<PathBuf>) -> Result<Self, StoreError> {
+        let root = root.into();
+        std::fs::create_dir_all(&root).map_err(|e| StoreError::DatabaseError(e.to_string()))?;
+        Ok(FileStore { root })
+    }
+
+    /// Reject ids that would escape the store directory.
+    fn safe_component(id: &str) -> Result<&str, StoreError> {
+        if id.is_empty() || id.contains(['/', '\\', '\0']) || id == "." || id == ".." {
+            return Err(StoreError::DatabaseError(format!(
+                "invalid path component: {:?}",
+                id
+            )));
+        }
+        Ok(id)
+    }
+
+    fn project_dir(&self, project: &ProjectId) -> Result<PathBuf, StoreError> {
+        Ok(self.root.join(Self::safe_component(project.as_str())?))
+    }
+
+    fn snapshot_path(
+        &self,
+        project: &ProjectId,
+        commit: &CommitId,
+    ) -> Result<PathBuf, StoreError> {
+        Ok(self
+            .project_dir(project)?
+            .join(format!("{}.sysb", Self::safe_component(commit.as_str())?)))
+    }
+
+    fn read_index(&self, project: &ProjectId) -> Result<ProjectIndex, StoreError> {
+        let path = self.project_dir(project)?.join("commits.json");
+        match std::fs::read_to_string(&path) {
+            Ok(json) => serde_json::from_str(&json)
+                .map_err(|e| StoreError::DeserializationError(e.to_string())),
+            Err(e) if e.kind() == std::io::ErrorKind::NotFound => Ok(ProjectIndex::default()),
+            Err(e) => Err(StoreError::DatabaseError(e.to_string())),
+        }
+    }
+
+    fn write_index(&self, project: &ProjectId, index: &ProjectIndex) -> Result<(), StoreError> {
+        let path = self.project_dir(project)?.join("commits.json");
+        let json = serde_json::to_string(index)
+            .map_err(|e| StoreError::SerializationError(e.to_string()))?;
+        std::fs::write(path, json).map_err(|e| StoreError::DatabaseError(e.to_string()))
+    }
+
+    /// Open a commit's snapshot by memory-mapping its file.
+    ///
+    /// Returns `None` if the commit does not exist. Unlike
+    /// [`Store::get_snapshot`], nothing is decoded until records are
+    /// accessed.
+    pub fn open_snapshot(
+        &self,
+        project: &ProjectId,
+        commit: &CommitId,
+    ) -> Result<Option<BinarySnapshot>, StoreError> {
+        let path = self.snapshot_path(project, commit)?;
+        if !path.exists() {
+            return Ok(None);
+        }
+        BinarySnapshot::open(path).map(Some)
+    }
+}
+
+impl Store for FileStore {
+    fn put_snapshot(
+        &mut self,
+        project: &ProjectId,
+        meta: SnapshotMeta,
+        graph: &ModelGraph,
+    ) -> Result<(), StoreError> {
+        let path = self.snapshot_path(project, &meta.commit)?;
+        if path.exists() {
+            return Err(StoreError::Conflict(format!(
+                "commit {} already exists",
+                meta.commit
+            )));
+        }
+
+        std::fs::create_dir_all(self.project_dir(project)?)
+            .map_err(|e| StoreError::DatabaseError(e.to_string()))?;
+        std::fs::write(&path, encode_graph(graph)?)
+            .map_err(|e| StoreError::DatabaseError(e.to_string()))?;
+
+        let mut index = self.read_index(project)?;
+        index.commits.push(meta);
+        self.write_index(project, &index)
+    }
+
+    fn get_snapshot(
+        &self,
+        project: &ProjectId,
+        commit: &CommitId,
+    ) -> Result<Option<Snapshot>, StoreError> {
+        // Compatibility path: materialize the full graph into the JSON
+        // Snapshot shape. Prefer `open_snapshot` for lazy access.
+        let binary = match self.open_snapshot(project, commit)? {
+            Some(binary) => binary,
+            None => return Ok(None),
+        };
+        let index = self.read_index(project)?;
+        let meta = index
+            .commits
+            .into_iter()
+            .find(|m| &m.commit == commit)
+            .ok_or_else(|| StoreError::CommitNotFound(commit.as_str().to_string()))?;
+        Ok(Some(Snapshot::new(meta, &binary.graph()?)))
+    }
+
+    fn latest(&self, project: &ProjectId) -> Result<Option<CommitId>, StoreError> {
+        Ok(self.read_index(project)?.commits.last().map(|m| m.commit.clone()))
+    }
+
+    fn list_commits(&self, project: &ProjectId) -> Result<Vec<SnapshotMeta>, StoreError> {
+        Ok(self.read_index(project)?.commits.into_iter().rev().collect())
+    }
+
+    fn list_projects(&self) -> Result<Vec<ProjectId>, StoreError> {
+        let entries =
+            std::fs::read_dir(&self.root).map_err(|e| StoreError::DatabaseError(e.to_string()))?;
+        let mut projects = Vec::new();
+        for entry in entries {
+            let entry = entry.map_err(|e| StoreError::DatabaseError(e.to_string()))?;
+            if entry.path().is_dir() {
+                if let Some(name) = entry.file_name().to_str() {
+                    projects.push(ProjectId::new(name));
+                }
+            }
+        }
+        projects.sort_by(|a, b| a.as_str().cmp(b.as_str()));
+        Ok(projects)
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use sysml_core::{ElementKind, RelationshipKind};
+
+    fn create_test_graph() -> ModelGraph {
+        let mut graph = ModelGraph::new();
+        let pkg = Element::new_with_kind(ElementKind::Package).with_name("Pkg");
+        let pkg_id = graph.add_element(pkg);
+        let part = Element::new_with_kind(ElementKind::PartUsage).with_name("Part");
+        let part_id = graph.add_element(part);
+        graph.add_relationship(Relationship::new(
+            RelationshipKind::Owning,
+            pkg_id,
+            part_id,
+        ));
+        graph
+    }
+
+    #[test]
+    fn binary_roundtrip() {
+        let graph = create_test_graph();
+        let bytes = encode_graph(&graph).unwrap();
+        let snapshot = BinarySnapshot::from_bytes(bytes).unwrap();
+
+        assert_eq!(snapshot.element_count(), graph.element_count());
+        assert_eq!(snapshot.relationship_count(), graph.relationship_count());
+
+        let restored = snapshot.graph().unwrap();
+        assert_eq!(restored.element_count(), graph.element_count());
+        assert_eq!(restored.relationship_count(), graph.relationship_count());
+    }
+
+    #[test]
+    fn binary_point_lookup_decodes_one_record() {
+        let graph = create_test_graph();
+        let snapshot = BinarySnapshot::from_bytes(encode_graph(&graph).unwrap()).unwrap();
+
+        for (id, element) in graph.elements.iter() {
+            let found = snapshot.get_element(id).unwrap().unwrap();
+            assert_eq!(found.name, element.name);
+            assert_eq!(found.kind, element.kind);
+        }
+        for id in graph.relationships.keys() {
+            assert!(snapshot.get_relationship(id).unwrap().is_some());
+        }
+        assert!(snapshot.get_element(&ElementId::new_v4()).unwrap().is_none());
+        assert_eq!(snapshot.element_ids().count(), graph.element_count());
+    }
+
+    #[test]
+    fn binary_rejects_bad_input() {
+        assert!(BinarySnapshot::from_bytes(vec![1, 2, 3]).is_err());
+
+        let graph = create_test_graph();
+        let mut bytes = encode_graph(&graph).unwrap();
+        bytes[4] = 99; // bogus version
+        assert!(BinarySnapshot::from_bytes(bytes).is_err());
+    }
+
+    #[test]
+    fn file_store_roundtrip_and_mmap() {
+        let dir = std::env::temp_dir().join(format!("sysml-store-test-{}", std::process::id()));
+        let _ = std::fs::remove_dir_all(&dir);
+        let mut store = FileStore::new(&dir).unwrap();
+
+        let project = ProjectId::new("proj");
+        let commit = CommitId::new("v1");
+        let graph = create_test_graph();
+        store
+            .put_snapshot(&project, SnapshotMeta::new(commit.clone(), "Initial"), &graph)
+            .unwrap();
+
+        // Lazy, memory-mapped access.
+        let snapshot = store.open_snapshot(&project, &commit).unwrap().unwrap();
+        assert_eq!(snapshot.element_count(), graph.element_count());
+        let first_id = graph.elements.keys().next().unwrap();
+        assert!(snapshot.get_element(first_id).unwrap().is_some());
+
+        // Trait-level access still works.
+        let full = store.get_snapshot(&project, &commit).unwrap().unwrap();
+        assert_eq!(full.graph().unwrap().element_count(), graph.element_count());
+        assert_eq!(store.latest(&project).unwrap().unwrap().as_str(), "v1");
+        assert_eq!(store.list_commits(&project).unwrap().len(), 1);
+        assert_eq!(store.list_projects().unwrap().len(), 1);
+
+        // Duplicate commits conflict.
+        let result =
+            store.put_snapshot(&project, SnapshotMeta::new(commit, "Again"), &graph);
+        assert!(matches!(result, Err(StoreError::Conflict(_))));
+
+        let _ = std::fs::remove_dir_all(&dir);
+    }
+}
@@ -0,0 +1,436 @@
+//! Delta-encoded commits.
+//!
+//! Consecutive commits usually differ by a handful of elements, yet a plain
+//! snapshot store persists a full serialized graph per commit. This module
+//! stores a commit as a structural diff against its parent instead: a
+//! [`GraphDelta`] of added/removed/changed elements and relationships.
+//! Reconstruction walks the parent chain back to the nearest full snapshot
+//! (a *keyframe*) and applies the deltas forward; keyframes are written
+//! periodically so chains stay short.
+
+use std::collections::HashMap;
+
+use sysml_core::{Element, ModelGraph, Relationship};
+use sysml_id::{CommitId, ElementId, ProjectId};
+
+use crate::{Snapshot, SnapshotMeta, Store, StoreError};
+
+/// A structural diff between two model graphs.
+///
+/// `upserted_*` holds full copies of added *and* changed records (applying
+/// an upsert is the same either way), so a delta is self-contained and
+/// proportional to the edit size.
+#[derive(Debug, Clone, Default, serde::Serialize, serde::Deserialize)]
+pub struct GraphDelta {
+    /// Elements added or changed relative to the parent.
+    pub upserted_elements: Vec<Element>,
+    /// Elements removed relative to the parent.
+    pub removed_elements: Vec<ElementId>,
+    /// Relationships added or changed relative to the parent.
+    pub upserted_relationships: Vec<Relationship>,
+    /// Relationships removed relative to the parent.
+    pub removed_relationships: Vec<ElementId>,
+}
+
+impl GraphDelta {
+    /// Compute the delta that turns `parent` into `child`.
+    pub fn between(parent: &ModelGraph, child: &ModelGraph) -> Self {
+        let mut delta = GraphDelta::default();
+
+        for (id, element) in child.elements.iter() {
+            match parent.elements.get(id) {
+                Some(existing) if existing == element => {}
+                _ => delta.upserted_elements.push(element.clone()),
+            }
+        }
+        for id in parent.elements.keys() {
+            if !child.elements.contains_key(id) {
+                delta.removed_elements.push(id.clone());
+            }
+        }
+
+        for (id, relationship) in child.relationships.iter() {
+            match parent.relationships.get(id) {
+                Some(existing) if existing == relationship => {}
+                _ => delta.upserted_relationships.push(relationship.clone()),
+            }
+        }
+        for id in parent.relationships.keys() {
+            if !child.relationships.contains_key(id) {
+                delta.removed_relationships.push(id.clone());
+            }
+        }
+
+        delta
+    }
+
+    /// Apply the delta to a graph in place.
+    ///
+    /// Removals run first, then upserts (replacing any changed records), so
+    /// the graph's indexes stay consistent throughout.
+    pub fn apply(&self, graph: &mut ModelGraph) {
+        for id in &self.removed_relationships {
+            graph.remove_relationship(id);
+        }
+        for id in &self.removed_elements {
+            graph.remove_element(id);
+        }
+        for element in &self.upserted_elements {
+            if graph.elements.contains_key(&element.id) {
+                graph.remove_element(&element.id);
+            }
+            graph.add_element(element.clone());
+        }
+        for relationship in &self.upserted_relationships {
+            if graph.relationships.contains_key(&relationship.id) {
+                graph.remove_relationship(&relationship.id);
+            }
+            graph.add_relationship(relationship.clone());
+        }
+    }
+
+    /// The number of changed records in the delta.
+    pub fn change_count(&self) -> usize {
+        self.upserted_elements.len()
+            + self.removed_elements.len()
+            + self.upserted_relationships.len()
+            + self.removed_relationships.len()
+    }
+
+    /// Check if the delta changes nothing.
+    pub fn is_empty(&self) -> bool {
+        self.change_count() == 0
+    }
+}
+
+/// How a commit is stored in a delta store.
+#[derive(Debug, Clone)]
+enum CommitPayload {
+    /// Full snapshot graph; starts a new delta chain.
+    Keyframe(ModelGraph),
+    /// Diff against the parent commit, `depth` deltas after a keyframe.
+    Delta {
+        parent: CommitId,
+        delta: GraphDelta,
+        depth: usize,
+    },
+}
+
+/// Default number of delta commits between keyframes.
+const DEFAULT_KEYFRAME_INTERVAL: usize = 10;
+
+/// An in-memory store that persists commits as deltas against their parent.
+///
+/// The first commit of a project — and every commit whose delta chain would
+/// exceed the keyframe interval — is stored as a full graph (a keyframe);
+/// everything else stores only its [`GraphDelta`], so commit writes are
+/// proportional to the edit size. Reconstruction walks back to the nearest
+/// keyframe and applies deltas forward.
+#[derive(Debug, Default)]
+pub struct InMemoryDeltaStore {
+    /// Commit payloads indexed by (project, commit).
+    payloads: HashMap<(String, String), CommitPayload>,
+    /// Latest commit for each project.
+    latest: HashMap<String, CommitId>,
+    /// All commits for each project (in order).
+    commits: HashMap<String, Vec<SnapshotMeta>>,
+    /// Delta chain length after which a keyframe is forced.
+    keyframe_interval: usize,
+}
+
+impl InMemoryDeltaStore {
+    /// Create a new empty delta store with the default keyframe interval.
+    pub fn new() -> Self {
+        Self::with_keyframe_interval(DEFAULT_KEYFRAME_INTERVAL)
+    }
+
+    /// Create a delta store with a custom keyframe interval.
+    ///
+    /// An interval of 0 stores every commit as a keyframe.
+    pub fn with_keyframe_interval(keyframe_interval: usize) -> Self {
+        InMemoryDeltaStore {
+            payloads: HashMap::new(),
+            latest: HashMap::new(),
+            commits: HashMap::new(),
+            keyframe_interval,
+        }
+    }
+
+    fn key(project: &ProjectId, commit: &CommitId) -> (String, String) {
+        (
+            project.as_str().to_string(),
+            commit.as_str().to_string(),
+        )
+    }
+
+    /// Check whether a commit is stored as a keyframe.
+    ///
+    /// Returns `None` for unknown commits. Useful for storage diagnostics.
+    pub fn is_keyframe(&self, project: &ProjectId, commit: &CommitId) -> Option<bool> {
+        self.payloads
+            .get(&Self::key(project, commit))
+            .map(|p| matches!(p, CommitPayload::Keyframe(_)))
+    }
+
+    /// Reconstruct the graph at a commit by applying its delta chain.
+    fn reconstruct(
+        &self,
+        project: &ProjectId,
+        commit: &CommitId,
+    ) -> Result<Option<ModelGraph>, StoreError> {
+        // Walk back to the nearest keyframe, collecting the deltas to
+        // replay on the way forward.
+        let mut chain: Vec<&GraphDelta> = Vec::new();
+        let mut current = commit.clone();
+        let mut graph = loop {
+            match self.payloads.get(&Self::key(project, &current)) {
+                None => {
+                    return if chain.is_empty() {
+                        Ok(None)
+                    } else {
+                        Err(StoreError::CommitNotFound(current.as_str().to_string()))
+                    };
+                }
+                Some(CommitPayload::Keyframe(graph)) => break graph.clone(),
+                Some(CommitPayload::Delta { parent, delta, .. }) => {
+                    chain.push(delta);
+                    current = parent.clone();
+                }
+            }
+        };
+
+        for delta in chain.into_iter().rev() {
+            delta.apply(&mut graph);
+        }
+        Ok(Some(graph))
+    }
+
+    /// The delta chain depth a child of `commit` would have (None forces a
+    /// keyframe).
+    fn child_depth(&self, project: &ProjectId, commit: &CommitId) -> Option<usize> {
+        match self.payloads.get(&Self::key(project, commit))? {
+            CommitPayload::Keyframe(_) => Some(1),
+            CommitPayload::Delta { depth, .. } => Some(depth + 1),
+        }
+    }
+}
+
+impl Store for InMemoryDeltaStore {
+    fn put_snapshot(
+        &mut self,
+        project: &ProjectId,
+        meta: SnapshotMeta,
+        graph: &ModelGraph,
+    ) -> Result<(), StoreError> {
+        let key = Self::key(project, &meta.commit);
+        if self.payloads.contains_key(&key) {
+            return Err(StoreError::Conflict(format!(
+                "commit {} already exists",
+                meta.commit
+            )));
+        }
+
+        // Store a delta when the parent exists and the chain stays within
+        // the keyframe interval; otherwise a keyframe.
+        let payload = match meta
+            .parent
+            .as_ref()
+            .and_then(|parent| Some((parent, self.child_depth(project, parent)?)))
+        {
+            Some((parent, depth)) if depth <= self.keyframe_interval => {
+                let parent_graph = self
+                    .reconstruct(project, parent)?
+                    .ok_or_else(|| StoreError::CommitNotFound(parent.as_str().to_string()))?;
+                CommitPayload::Delta {
+                    parent: parent.clone(),
+                    delta: GraphDelta::between(&parent_graph, graph),
+                    depth,
+                }
+            }
+            _ => CommitPayload::Keyframe(graph.clone()),
+        };
+
+        self.payloads.insert(key, payload);
+        self.latest
+            .insert(project.as_str().to_string(), meta.commit.clone());
+        self.commits
+            .entry(project.as_str().to_string())
+            .or_default()
+            .push(meta);
+        Ok(())
+    }
+
+    fn get_snapshot(
+        &self,
+        project: &ProjectId,
+        commit: &CommitId,
+    ) -> Result<Option<Snapshot>, StoreError> {
+        let graph = match self.reconstruct(project, commit)? {
+            Some(graph) => graph,
+            None => return Ok(None),
+        };
+        let meta = self
+            .commits
+            .get(project.as_str())
+            .and_then(|metas| metas.iter().find(|m| &m.commit == commit))
+            .cloned()
+            .ok_or_else(|| StoreError::CommitNotFound(commit.as_str().to_string()))?;
+        Ok(Some(Snapshot::new(meta, &graph)))
+    }
+
+    fn latest(&self, project: &ProjectId) -> Result<Option<CommitId>, StoreError> {
+        Ok(self.latest.get(project.as_str()).cloned())
+    }
+
+    fn list_commits(&self, project: &ProjectId) -> Result<Vec<SnapshotMeta>, StoreError> {
+        Ok(self
+            .commits
+            .get(project.as_str())
+            .cloned()
+            .unwrap_or_default()
+            .into_iter()
+            .rev()
+            .collect())
+    }
+
+    fn list_projects(&self) -> Result<Vec<ProjectId>, StoreError> {
+        Ok(self
+            .commits
+            .keys()
+            .map(|k| ProjectId::new(k.clone()))
+            .collect())
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use sysml_core::{ElementKind, RelationshipKind};
+
+    fn base_graph() -> ModelGraph {
+        let mut graph = ModelGraph::new();
+        let pkg = Element::new_with_kind(ElementKind::Package).with_name("Pkg");
+        let pkg_id = graph.add_element(pkg);
+        let part = Element::new_with_kind(ElementKind::PartUsage).with_name("Part");
+        let part_id = graph.add_element(part);
+        graph.add_relationship(Relationship::new(
+            RelationshipKind::Owning,
+            pkg_id,
+            part_id,
+        ));
+        graph
+    }
+
+    #[test]
+    fn delta_between_and_apply_roundtrip() {
+        let parent = base_graph();
+        let mut child = parent.clone();
+
+        // Add one element, remove one, change one.
+        let added = Element::new_with_kind(ElementKind::AttributeUsage).with_name("mass");
+        child.add_element(added);
+        let removed_id = parent
+            .elements
+            .values()
+            .find(|e| e.name.as_deref() == Some("Part"))
+            .unwrap()
+            .id
+            .clone();
+        child.remove_element(&removed_id);
+        let changed_id = parent
+            .elements
+            .values()
+            .find(|e| e.name.as_deref() == Some("Pkg"))
+            .unwrap()
+            .id
+            .clone();
+        child.elements.get_mut(&changed_id).unwrap().name = Some("Renamed".to_string());
+
+        let delta = GraphDelta::between(&parent, &child);
+        assert_eq!(delta.upserted_elements.len(), 2); // added + changed
+        assert_eq!(delta.removed_elements.len(), 1);
+
+        let mut reconstructed = parent.clone();
+        delta.apply(&mut reconstructed);
+        assert_eq!(reconstructed.elements, child.elements);
+        assert_eq!(reconstructed.relationships, child.relationships);
+    }
+
+    #[test]
+    fn delta_store_reconstructs_chain() {
+        let mut store = InMemoryDeltaStore::new();
+        let project = ProjectId::new("proj");
+
+        let mut graph = base_graph();
+        store
+            .put_snapshot(&project, SnapshotMeta::new(CommitId::new("v1"), "Initial"), &graph)
+            .unwrap();
+
+        // A chain of small edits, each stored as a delta.
+        for i in 2..=5 {
+            let elem = Element::new_with_kind(ElementKind::PartUsage)
+                .with_name(format!("Part{}", i));
+            graph.add_element(elem);
+            let meta = SnapshotMeta::new(CommitId::new(format!("v{}", i)), "Edit")
+                .with_parent(CommitId::new(format!("v{}", i - 1)));
+            store.put_snapshot(&project, meta, &graph).unwrap();
+        }
+
+        assert_eq!(store.is_keyframe(&project, &CommitId::new("v1")), Some(true));
+        assert_eq!(store.is_keyframe(&project, &CommitId::new("v3")), Some(false));
+
+        let snapshot = store
+            .get_snapshot(&project, &CommitId::new("v5"))
+            .unwrap()
+            .unwrap();
+        assert_eq!(snapshot.graph().unwrap().element_count(), graph.element_count());
+
+        // Intermediate commits reconstruct too.
+        let mid = store
+            .get_snapshot(&project, &CommitId::new("v3"))
+            .unwrap()
+            .unwrap();
+        assert_eq!(mid.graph().unwrap().element_count(), 4);
+    }
+
+    #[test]
+    fn keyframe_interval_bounds_chain_length() {
+        let mut store = InMemoryDeltaStore::with_keyframe_interval(2);
+        let project = ProjectId::new("proj");
+
+        let mut graph = base_graph();
+        store
+            .put_snapshot(&project, SnapshotMeta::new(CommitId::new("v1"), "Initial"), &graph)
+            .unwrap();
+        for i in 2..=6 {
+            let elem = Element::new_with_kind(ElementKind::PartUsage)
+                .with_name(format!("Part{}", i));
+            graph.add_element(elem);
+            let meta = SnapshotMeta::new(CommitId::new(format!("v{}", i)), "Edit")
+                .with_parent(CommitId::new(format!("v{}", i - 1)));
+            store.put_snapshot(&project, meta, &graph).unwrap();
+        }
+
+        // v1 keyframe, v2/v3 deltas, v4 forced keyframe, v5/v6 deltas.
+        assert_eq!(store.is_keyframe(&project, &CommitId::new("v4")), Some(true));
+        assert_eq!(store.is_keyframe(&project, &CommitId::new("v6")), Some(false));
+
+        let snapshot = store
+            .get_snapshot(&project, &CommitId::new("v6"))
+            .unwrap()
+            .unwrap();
+        assert_eq!(snapshot.graph().unwrap().element_count(), graph.element_count());
+    }
+
+    #[test]
+    fn commit_without_stored_parent_becomes_keyframe() {
+        let mut store = InMemoryDeltaStore::new();
+        let project = ProjectId::new("proj");
+        let graph = base_graph();
+
+        let meta = SnapshotMeta::new(CommitId::new("v9"), "Orphan")
+            .with_parent(CommitId::new("missing"));
+        store.put_snapshot(&project, meta, &graph).unwrap();
+        assert_eq!(store.is_keyframe(&project, &CommitId::new("v9")), Some(true));
+    }
+}
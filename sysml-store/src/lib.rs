@@ -11,6 +11,12 @@ use sysml_core::ModelGraph;
 use sysml_id::{CommitId, ProjectId};
 use thiserror::Error;
 
+pub mod binary;
+pub mod delta;
+
+pub use binary::{encode_graph, BinarySnapshot, FileStore};
+pub use delta::{GraphDelta, InMemoryDeltaStore};
+
 /// Errors that can occur during storage operations.
 #[derive(Debug, Error)]
 pub enum StoreError {
@@ -40,7 +46,7 @@ pub enum StoreError {
 }
 
 /// Metadata about a snapshot.
-#[derive(Debug, Clone)]
+#[derive(Debug, Clone, serde::Serialize, serde::Deserialize)]
 pub struct SnapshotMeta {
     /// The commit ID.
     pub commit: CommitId,
@@ -2,6 +2,11 @@
 //!
 //! These structs hold all data extracted from pest pairs in a single traversal,
 //! avoiding the overhead of multiple `.clone().into_inner()` calls.
+//!
+//! All extracted text is borrowed as `&str` slices of the source (pest pairs
+//! already borrow from the input), so extraction itself performs no string
+//! allocation; owned copies are made only when the converter builds the
+//! final `Element`s.
 
 use pest::iterators::Pair;
 
@@ -30,14 +35,14 @@ pub struct UsageExtraction<'a> {
     pub direction: Option<&'static str>,
 
     // === Identification from declaration ===
-    pub name: Option<String>,
+    pub name: Option<&'a str>,
 
     // === Multiplicity ===
     /// (lower, upper) where upper=None means unbounded (*)
     pub multiplicity: Option<(i64, Option<i64>)>,
 
     // === Feature value ===
-    pub value_expression: Option<String>,
+    pub value_expression: Option<&'a str>,
     pub value_is_default: bool,
     pub value_is_initial: bool,
     /// Whether the value is a literal (not a reference that needs resolution)
@@ -45,13 +50,13 @@ pub struct UsageExtraction<'a> {
 
     // === Feature specializations ===
     /// FeatureTyping targets (from `:` or `typed by` syntax)
-    pub typings: Vec<String>,
+    pub typings: Vec<&'a str>,
     /// Subsetting targets (from `:>` or `subsets` syntax)
-    pub subsettings: Vec<String>,
+    pub subsettings: Vec<&'a str>,
     /// Redefinition targets (from `:>>` or `redefines` syntax)
-    pub redefinitions: Vec<String>,
+    pub redefinitions: Vec<&'a str>,
     /// ReferenceSubsetting targets (from `::>` or `references` syntax)
-    pub references: Vec<String>,
+    pub references: Vec<&'a str>,
 
     // === Body members (stored for later processing) ===
     pub body_pairs: Vec<Pair<'a, Rule>>,
@@ -65,10 +70,10 @@ pub struct DefinitionExtraction<'a> {
     pub is_variation: bool,
 
     // === Identification from declaration ===
-    pub name: Option<String>,
+    pub name: Option<&'a str>,
 
     // === Subclassification targets ===
-    pub subclassifications: Vec<String>,
+    pub subclassifications: Vec<&'a str>,
 
     // === Body members (stored for later processing) ===
     pub body_pairs: Vec<Pair<'a, Rule>>,
@@ -77,7 +82,7 @@ pub struct DefinitionExtraction<'a> {
 /// All data extracted from a Package element in one pass.
 #[derive(Debug, Default)]
 pub struct PackageExtraction<'a> {
-    pub name: Option<String>,
+    pub name: Option<&'a str>,
     pub is_standard: bool,
     pub body_pairs: Vec<Pair<'a, Rule>>,
 }
@@ -366,7 +371,7 @@ impl<'a> UsageExtraction<'a> {
             if inner.as_rule() == Rule::OwnedExpression {
                 // Check if the expression is a literal
                 self.value_is_literal = Self::is_literal_expression(&inner);
-                self.value_expression = Some(inner.as_str().trim().to_string());
+                self.value_expression = Some(inner.as_str().trim());
                 return;
             }
         }
@@ -384,7 +389,7 @@ impl<'a> UsageExtraction<'a> {
         if !s.is_empty() {
             // Check if the fallback value looks like a literal
             self.value_is_literal = Self::text_looks_like_literal(s);
-            self.value_expression = Some(s.to_string());
+            self.value_expression = Some(s);
         }
     }
 
@@ -571,7 +576,7 @@ impl<'a> DefinitionExtraction<'a> {
     fn extract_subclassification_part(&mut self, pair: Pair<'a, Rule>) {
         for inner in pair.into_inner() {
             if let Rule::OwnedSubclassification = inner.as_rule() {
-                let qname = inner.as_str().trim().to_string();
+                let qname = inner.as_str().trim();
                 if !qname.is_empty() {
                     self.subclassifications.push(qname);
                 }
@@ -647,18 +652,19 @@ impl<'a> PackageExtraction<'a> {
 // Helper functions
 // =============================================================================
 
-/// Extract name from RegularName pair.
-fn extract_name_from_regular_name(pair: &Pair<'_, Rule>) -> Option<String> {
+/// Extract name from RegularName pair as a slice of the source.
+fn extract_name_from_regular_name<'a>(pair: &Pair<'a, Rule>) -> Option<&'a str> {
     for inner in pair.clone().into_inner() {
         if let Rule::Name = inner.as_rule() {
-            let inner_str = inner.as_str().to_string();
+            let inner_str = inner.as_str();
             for name_inner in inner.into_inner() {
                 match name_inner.as_rule() {
-                    Rule::ID => return Some(name_inner.as_str().to_string()),
+                    Rule::ID => return Some(name_inner.as_str()),
                     Rule::UNRESTRICTED_NAME => {
+                        // Strip the surrounding quotes; still a borrow.
                         let s = name_inner.as_str();
                         if s.len() >= 2 {
-                            return Some(s[1..s.len() - 1].to_string());
+                            return Some(&s[1..s.len() - 1]);
                         }
                     }
                     _ => {}
@@ -667,15 +673,15 @@ fn extract_name_from_regular_name(pair: &Pair<'_, Rule>) -> Option<String> {
             return Some(inner_str);
         }
     }
-    Some(pair.as_str().to_string())
+    Some(pair.as_str())
 }
 
-/// Extract qualified names from a pair into a vec.
-fn extract_qualified_names_into(pair: &Pair<'_, Rule>, targets: &mut Vec<String>) {
+/// Extract qualified names from a pair into a vec of source slices.
+fn extract_qualified_names_into<'a>(pair: &Pair<'a, Rule>, targets: &mut Vec<&'a str>) {
     for inner in pair.clone().into_inner() {
         match inner.as_rule() {
             Rule::QualifiedName => {
-                let name = inner.as_str().trim().to_string();
+                let name = inner.as_str().trim();
                 if !name.is_empty() {
                     targets.push(name);
                 }
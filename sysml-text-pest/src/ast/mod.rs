@@ -591,10 +591,7 @@ impl<'a> Converter<'a> {
 
     /// Push children of a pair onto the work stack in reverse order (for LIFO processing).
     fn push_children<'b>(&self, pair: Pair<'b, Rule>, work_stack: &mut Vec<WorkItem<'b>>) {
-        let children: Vec<_> = pair.into_inner().collect();
-        for child in children.into_iter().rev() {
-            work_stack.push(WorkItem::ProcessPair(child));
-        }
+        work_stack.extend(pair.into_inner().rev().map(WorkItem::ProcessPair));
     }
 
     /// Process a Package using single-pass extraction.
@@ -610,7 +607,7 @@ impl<'a> Converter<'a> {
         let mut element = Element::new_with_kind(ElementKind::Package);
 
         if let Some(name) = extraction.name {
-            element.name = Some(name);
+            element.name = Some(name.to_string());
         }
 
         if let Some(s) = span {
@@ -642,7 +639,7 @@ impl<'a> Converter<'a> {
         let mut element = Element::new_with_kind(ElementKind::LibraryPackage);
 
         if let Some(name) = extraction.name {
-            element.name = Some(name);
+            element.name = Some(name.to_string());
         }
 
         if extraction.is_standard {
@@ -679,7 +676,7 @@ impl<'a> Converter<'a> {
         let mut element = Element::new_with_kind(kind);
 
         if let Some(name) = extraction.name {
-            element.name = Some(name);
+            element.name = Some(name.to_string());
         }
 
         if extraction.is_abstract {
@@ -724,7 +721,7 @@ impl<'a> Converter<'a> {
         let mut element = Element::new_with_kind(kind);
 
         if let Some(name) = extraction.name {
-            element.name = Some(name);
+            element.name = Some(name.to_string());
         }
 
         if let Some(direction) = extraction.direction {
@@ -743,7 +740,7 @@ impl<'a> Converter<'a> {
             // Only store as unresolved_value if it's NOT a literal
             // Literals are handled by the LiteralExpression handlers and create proper elements
             if !extraction.value_is_literal {
-                element.set_prop("unresolved_value", Value::String(value_expression));
+                element.set_prop("unresolved_value", Value::String(value_expression.to_string()));
             }
             if extraction.value_is_default {
                 element.set_prop("isDefault", true);
@@ -1117,13 +1114,13 @@ impl<'a> Converter<'a> {
     fn create_specialization(
         &self,
         specific_id: ElementId,
-        general_qname: String,
+        general_qname: &str,
         graph: &mut ModelGraph,
         span: Option<Span>,
     ) -> ElementId {
         let mut element = Element::new_with_kind(ElementKind::Specialization);
         element.set_prop("specific", Value::Ref(specific_id.clone()));
-        element.set_prop("unresolved_general", Value::String(general_qname));
+        element.set_prop("unresolved_general", Value::String(general_qname.to_string()));
 
         if let Some(s) = span {
             element.spans.push(s);
@@ -1139,13 +1136,13 @@ impl<'a> Converter<'a> {
     fn create_feature_typing(
         &self,
         typed_feature_id: ElementId,
-        type_qname: String,
+        type_qname: &str,
         graph: &mut ModelGraph,
         span: Option<Span>,
     ) -> ElementId {
         let mut element = Element::new_with_kind(ElementKind::FeatureTyping);
         element.set_prop("typedFeature", Value::Ref(typed_feature_id.clone()));
-        element.set_prop("unresolved_type", Value::String(type_qname));
+        element.set_prop("unresolved_type", Value::String(type_qname.to_string()));
 
         if let Some(s) = span {
             element.spans.push(s);
@@ -1161,13 +1158,13 @@ impl<'a> Converter<'a> {
     fn create_subsetting(
         &self,
         subsetting_feature_id: ElementId,
-        subsetted_qname: String,
+        subsetted_qname: &str,
         graph: &mut ModelGraph,
         span: Option<Span>,
     ) -> ElementId {
         let mut element = Element::new_with_kind(ElementKind::Subsetting);
         element.set_prop("subsettingFeature", Value::Ref(subsetting_feature_id.clone()));
-        element.set_prop("unresolved_subsettedFeature", Value::String(subsetted_qname));
+        element.set_prop("unresolved_subsettedFeature", Value::String(subsetted_qname.to_string()));
 
         if let Some(s) = span {
             element.spans.push(s);
@@ -1183,13 +1180,13 @@ impl<'a> Converter<'a> {
     fn create_redefinition(
         &self,
         redefining_feature_id: ElementId,
-        redefined_qname: String,
+        redefined_qname: &str,
         graph: &mut ModelGraph,
         span: Option<Span>,
     ) -> ElementId {
         let mut element = Element::new_with_kind(ElementKind::Redefinition);
         element.set_prop("redefiningFeature", Value::Ref(redefining_feature_id.clone()));
-        element.set_prop("unresolved_redefinedFeature", Value::String(redefined_qname));
+        element.set_prop("unresolved_redefinedFeature", Value::String(redefined_qname.to_string()));
 
         if let Some(s) = span {
             element.spans.push(s);
@@ -1205,13 +1202,13 @@ impl<'a> Converter<'a> {
     fn create_reference_subsetting(
         &self,
         referencing_feature_id: ElementId,
-        referenced_qname: String,
+        referenced_qname: &str,
         graph: &mut ModelGraph,
         span: Option<Span>,
     ) -> ElementId {
         let mut element = Element::new_with_kind(ElementKind::ReferenceSubsetting);
         element.set_prop("referencingFeature", Value::Ref(referencing_feature_id.clone()));
-        element.set_prop("unresolved_referencedFeature", Value::String(referenced_qname));
+        element.set_prop("unresolved_referencedFeature", Value::String(referenced_qname.to_string()));
 
         if let Some(s) = span {
             element.spans.push(s);
@@ -0,0 +1,334 @@
+//! Single-pass lexer for SysML v2 source text.
+//!
+//! Tokenizes a file once into a flat stream of [`Token`]s borrowing from the
+//! source, classifying identifiers, literals, comments, and punctuation in
+//! one linear scan. SysML keywords are *contextual* (the grammar resolves
+//! them by position, not reservation), so keywords lex as identifiers;
+//! [`Token::keyword_id`] gives their integer ID for token-based matching.
+//!
+//! The parser runs this pass before pest: lexically broken files (an
+//! unterminated string or comment, an illegal character) are rejected with
+//! precise spans without paying for full PEG error recovery, and the token
+//! stream is available to later stages that want to match token IDs rather
+//! than re-scan text.
+
+/// The contextual keywords of SysML v2 and KerML, sorted for binary search.
+///
+/// Mirrors the keyword set extracted from the xtext specifications by the
+/// grammar build (including the grammar's extra keywords); a token's
+/// keyword ID is its index in this table.
+pub static KEYWORDS: &[&str] = &[
+    "about", "abstract", "accept", "action", "actor", "after", "alias", "all", "allocate",
+    "allocation", "analysis", "and", "as", "assert", "assign", "assoc", "assume", "at",
+    "attribute", "behavior", "bind", "binding", "bool", "by", "calc", "case", "chains", "class",
+    "classifier", "comment", "composite", "concern", "conjugate", "conjugates", "conjugation",
+    "connect", "connection", "connector", "const", "constant", "constraint", "crosses",
+    "datatype", "decide", "def", "default", "defined", "dependency", "derived", "differences",
+    "disjoining", "disjoint", "do", "doc", "else", "end", "entry", "enum", "event", "exhibit",
+    "exit", "expose", "expr", "false", "feature", "featured", "featuring", "filter", "first",
+    "flow", "for", "fork", "frame", "from", "function", "hastype", "if", "implies", "import",
+    "in", "include", "individual", "inout", "interaction", "interface", "intersects", "inv",
+    "inverse", "inverting", "istype", "item", "join", "language", "library", "locale", "loop",
+    "member", "merge", "message", "meta", "metaclass", "metadata", "multiplicity", "namespace",
+    "new", "nonunique", "not", "null", "objective", "occurrence", "of", "or", "ordered", "out",
+    "package", "parallel", "part", "perform", "port", "portion", "predicate", "private",
+    "protected", "public", "readonly", "redefines", "redefinition", "ref", "references",
+    "render", "rendering", "rep", "require", "requirement", "return", "satisfy", "send",
+    "snapshot", "specialization", "specializes", "stakeholder", "standard", "state", "step",
+    "struct", "subclassifier", "subject", "subset", "subsets", "subtype", "succession",
+    "terminate", "then", "timeslice", "to", "transition", "true", "type", "typed", "typing",
+    "unions", "until", "use", "var", "variant", "variation", "verification", "verify", "via",
+    "view", "viewpoint", "when", "while", "xor",
+];
+
+/// Multi-character operators, longest first so matching is greedy.
+static OPERATORS: &[&str] = &[
+    "::**", "::*", "::>", ":>>", ":>", ":=", "..", "->", "=>", "**", "==", "!=", "<=", ">=",
+    "&&", "||", "??",
+];
+
+/// The classification of a [`Token`].
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum TokenKind {
+    /// An identifier; possibly a contextual keyword (see [`Token::keyword_id`]).
+    Identifier,
+    /// A quoted name: `'name with spaces'`.
+    UnrestrictedName,
+    /// A double-quoted string literal.
+    StringLiteral,
+    /// An integer or real number literal.
+    Number,
+    /// An operator or delimiter.
+    Punctuation,
+    /// A `/* ... */` comment (may be a doc or comment body).
+    Comment,
+    /// A `//` or `//*` note (hidden from the model).
+    Note,
+    /// An unlexable region: unterminated literal/comment or illegal character.
+    Error,
+}
+
+/// One token, borrowing its text from the source.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct Token<'a> {
+    /// What kind of token this is.
+    pub kind: TokenKind,
+    /// The matched text.
+    pub text: &'a str,
+    /// Byte offset where the token starts.
+    pub start: usize,
+}
+
+impl<'a> Token<'a> {
+    /// Byte offset just past the token.
+    pub fn end(&self) -> usize {
+        self.start + self.text.len()
+    }
+
+    /// The keyword ID if this identifier is a contextual keyword.
+    pub fn keyword_id(&self) -> Option<u16> {
+        if self.kind != TokenKind::Identifier {
+            return None;
+        }
+        KEYWORDS.binary_search(&self.text).ok().map(|i| i as u16)
+    }
+}
+
+/// Tokenize `source` in one pass.
+///
+/// Whitespace is skipped; everything else becomes a token. The scan never
+/// fails — unlexable regions are reported as [`TokenKind::Error`] tokens so
+/// callers can turn them into diagnostics.
+pub fn lex(source: &str) -> Vec<Token<'_>> {
+    let bytes = source.as_bytes();
+    let mut tokens = Vec::new();
+    let mut pos = 0;
+
+    while pos < bytes.len() {
+        let byte = bytes[pos];
+
+        // Whitespace
+        if matches!(byte, b' ' | b'\t' | b'\r' | b'\n') {
+            pos += 1;
+            continue;
+        }
+
+        let start = pos;
+        let kind = if byte == b'/' && bytes.get(pos + 1) == Some(&b'/') {
+            // `//*` notes prefer a `*/` terminator (multi-line form),
+            // falling back to end of line; plain `//` runs to end of line.
+            if bytes.get(pos + 2) == Some(&b'*') {
+                match find(bytes, pos + 3, b"*/") {
+                    Some(end) => pos = end + 2,
+                    None => pos = line_end(bytes, pos + 3),
+                }
+            } else {
+                pos = line_end(bytes, pos + 2);
+            }
+            TokenKind::Note
+        } else if byte == b'/' && bytes.get(pos + 1) == Some(&b'*') {
+            match find(bytes, pos + 2, b"*/") {
+                Some(end) => {
+                    pos = end + 2;
+                    TokenKind::Comment
+                }
+                None => {
+                    pos = bytes.len();
+                    TokenKind::Error
+                }
+            }
+        } else if byte == b'"' || byte == b'\'' {
+            match quoted_end(bytes, pos + 1, byte) {
+                Some(end) => {
+                    pos = end;
+                    if byte == b'"' {
+                        TokenKind::StringLiteral
+                    } else {
+                        TokenKind::UnrestrictedName
+                    }
+                }
+                None => {
+                    pos = bytes.len();
+                    TokenKind::Error
+                }
+            }
+        } else if byte.is_ascii_digit() {
+            pos = number_end(bytes, pos);
+            TokenKind::Number
+        } else if byte.is_ascii_alphabetic() || byte == b'_' {
+            while pos < bytes.len() && (bytes[pos].is_ascii_alphanumeric() || bytes[pos] == b'_') {
+                pos += 1;
+            }
+            TokenKind::Identifier
+        } else if let Some(op) = OPERATORS.iter().find(|op| source[pos..].starts_with(**op)) {
+            pos += op.len();
+            TokenKind::Punctuation
+        } else if byte.is_ascii_punctuation() {
+            pos += 1;
+            TokenKind::Punctuation
+        } else {
+            // Skip one whole (possibly multi-byte) character.
+            let ch_len = source[pos..].chars().next().map(char::len_utf8).unwrap_or(1);
+            pos += ch_len;
+            TokenKind::Error
+        };
+
+        tokens.push(Token {
+            kind,
+            text: &source[start..pos],
+            start,
+        });
+    }
+
+    tokens
+}
+
+/// Find `needle` in `bytes` at or after `from`; returns its start offset.
+fn find(bytes: &[u8], from: usize, needle: &[u8]) -> Option<usize> {
+    if from > bytes.len() {
+        return None;
+    }
+    bytes[from..]
+        .windows(needle.len())
+        .position(|w| w == needle)
+        .map(|i| from + i)
+}
+
+/// Offset of the next newline at or after `from` (or end of input).
+fn line_end(bytes: &[u8], from: usize) -> usize {
+    bytes[from.min(bytes.len())..]
+        .iter()
+        .position(|b| *b == b'\n')
+        .map(|i| from + i)
+        .unwrap_or(bytes.len())
+}
+
+/// Offset just past the closing quote, honoring `\` escapes; `None` if the
+/// literal is unterminated before the end of input. Both string literals
+/// and unrestricted names may span lines, matching the grammar terminals.
+fn quoted_end(bytes: &[u8], mut pos: usize, quote: u8) -> Option<usize> {
+    while pos < bytes.len() {
+        match bytes[pos] {
+            b'\\' => pos += 2,
+            b if b == quote => return Some(pos + 1),
+            _ => pos += 1,
+        }
+    }
+    None
+}
+
+/// Offset just past a number literal: digits, optional fraction, optional
+/// exponent (mirroring the grammar's NUMBER terminal).
+fn number_end(bytes: &[u8], mut pos: usize) -> usize {
+    while pos < bytes.len() && bytes[pos].is_ascii_digit() {
+        pos += 1;
+    }
+    if bytes.get(pos) == Some(&b'.') && bytes.get(pos + 1).is_some_and(u8::is_ascii_digit) {
+        pos += 1;
+        while pos < bytes.len() && bytes[pos].is_ascii_digit() {
+            pos += 1;
+        }
+    }
+    if matches!(bytes.get(pos), Some(b'e' | b'E')) {
+        let mut exp = pos + 1;
+        if matches!(bytes.get(exp), Some(b'+' | b'-')) {
+            exp += 1;
+        }
+        if bytes.get(exp).is_some_and(u8::is_ascii_digit) {
+            pos = exp;
+            while pos < bytes.len() && bytes[pos].is_ascii_digit() {
+                pos += 1;
+            }
+        }
+    }
+    pos
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn kinds(source: &str) -> Vec<TokenKind> {
+        lex(source).into_iter().map(|t| t.kind).collect()
+    }
+
+    #[test]
+    fn lexes_simple_declaration() {
+        let tokens = lex("part def Wheel;");
+        let texts: Vec<&str> = tokens.iter().map(|t| t.text).collect();
+        assert_eq!(texts, vec!["part", "def", "Wheel", ";"]);
+        assert_eq!(
+            kinds("part def Wheel;"),
+            vec![
+                TokenKind::Identifier,
+                TokenKind::Identifier,
+                TokenKind::Identifier,
+                TokenKind::Punctuation,
+            ]
+        );
+    }
+
+    #[test]
+    fn keywords_are_identifiers_with_ids() {
+        let tokens = lex("part mass");
+        assert!(tokens[0].keyword_id().is_some());
+        assert_eq!(tokens[1].keyword_id(), None);
+        assert_eq!(
+            KEYWORDS[tokens[0].keyword_id().unwrap() as usize],
+            "part"
+        );
+    }
+
+    #[test]
+    fn keyword_table_is_sorted() {
+        let mut sorted = KEYWORDS.to_vec();
+        sorted.sort_unstable();
+        assert_eq!(sorted, KEYWORDS);
+    }
+
+    #[test]
+    fn multi_char_operators_match_greedily() {
+        let texts: Vec<&str> = lex("a ::> b :>> c :> d").iter().map(|t| t.text).collect();
+        assert_eq!(texts, vec!["a", "::>", "b", ":>>", "c", ":>", "d"]);
+    }
+
+    #[test]
+    fn lexes_literals_and_names() {
+        let tokens = lex(r#"attribute 'total mass' = 4.2e3; doc /* body */ s = "text";"#);
+        let kinds: Vec<TokenKind> = tokens.iter().map(|t| t.kind).collect();
+        assert!(kinds.contains(&TokenKind::UnrestrictedName));
+        assert!(kinds.contains(&TokenKind::Number));
+        assert!(kinds.contains(&TokenKind::Comment));
+        assert!(kinds.contains(&TokenKind::StringLiteral));
+        assert!(!kinds.contains(&TokenKind::Error));
+    }
+
+    #[test]
+    fn notes_are_hidden_tokens() {
+        assert_eq!(kinds("// line note\n"), vec![TokenKind::Note]);
+        assert_eq!(kinds("//* spanning\nnote */"), vec![TokenKind::Note]);
+    }
+
+    #[test]
+    fn escaped_quotes_stay_inside_literals() {
+        let tokens = lex(r#""with \" quote" 'it\'s'"#);
+        assert_eq!(tokens.len(), 2);
+        assert_eq!(tokens[0].kind, TokenKind::StringLiteral);
+        assert_eq!(tokens[1].kind, TokenKind::UnrestrictedName);
+    }
+
+    #[test]
+    fn unterminated_literals_are_errors() {
+        assert!(kinds("\"never closed").contains(&TokenKind::Error));
+        assert!(kinds("/* never closed").contains(&TokenKind::Error));
+        assert!(kinds("part x; \u{2603}").contains(&TokenKind::Error));
+    }
+
+    #[test]
+    fn offsets_cover_the_source() {
+        let source = "package P { part x : T; }";
+        for token in lex(source) {
+            assert_eq!(&source[token.start..token.end()], token.text);
+        }
+    }
+}
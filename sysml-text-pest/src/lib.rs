@@ -29,11 +29,12 @@
 use pest::Parser as PestParserTrait;
 use pest_derive::Parser;
 use rayon::prelude::*;
-use sysml_core::ModelGraph;
-use sysml_span::{Diagnostic, Span};
+use sysml_core::{GraphBuilder, ModelGraph};
+use sysml_span::{Diagnostic, LineIndex, Span};
 use sysml_text::{ParseResult, Parser, SysmlFile};
 
 pub mod ast;
+pub mod lexer;
 
 /// The pest parser generated from the grammar file.
 ///
@@ -101,6 +102,13 @@ impl PestParser {
         let mut graph = ModelGraph::new();
         let mut diagnostics = Vec::new();
 
+        // Tokenize once up front. Lexically broken files fail fast here with
+        // precise spans instead of paying for full PEG error recovery.
+        let lex_diagnostics = lexical_diagnostics(file);
+        if !lex_diagnostics.is_empty() {
+            return (graph, lex_diagnostics);
+        }
+
         // Parse using pest
         match SysmlGrammar::parse(Rule::File, &file.text) {
             Ok(pairs) => {
@@ -188,6 +196,41 @@ impl PestParser {
     }
 }
 
+/// Run the single-pass lexer over a file and report unlexable regions.
+///
+/// Returns an empty vec for lexically valid input. The line index is built
+/// only when errors exist, since that is the rare path.
+fn lexical_diagnostics(file: &SysmlFile) -> Vec<Diagnostic> {
+    let errors: Vec<lexer::Token<'_>> = lexer::lex(&file.text)
+        .into_iter()
+        .filter(|t| t.kind == lexer::TokenKind::Error)
+        .collect();
+    if errors.is_empty() {
+        return Vec::new();
+    }
+
+    let index = LineIndex::new(&file.text);
+    errors
+        .into_iter()
+        .map(|token| {
+            let message = match token.text.as_bytes().first() {
+                Some(b'"') => "unterminated string literal".to_string(),
+                Some(b'\'') => "unterminated name".to_string(),
+                Some(b'/') => "unterminated comment".to_string(),
+                _ => format!("unexpected character `{}`", token.text.escape_default()),
+            };
+            let (line, col) = index.line_col(token.start);
+            Diagnostic::error(format!("Lexical error: {}", message)).with_span(Span::with_location(
+                &file.path,
+                token.start,
+                token.end(),
+                line,
+                col,
+            ))
+        })
+        .collect()
+}
+
 fn format_rule_list(rules: &[Rule]) -> String {
     if rules.is_empty() {
         return String::new();
@@ -248,27 +291,22 @@ impl Parser for PestParser {
             inputs.iter().map(|file| self.parse_file(file)).collect()
         };
 
-        // Sequential merge phase (unavoidable - mutates single graph)
-        let mut combined_graph = ModelGraph::new();
+        // Sequential merge phase. Bulk-load through GraphBuilder so each
+        // per-file graph is drained in input order (deterministic for
+        // downstream graph building) and every index is wired exactly once,
+        // instead of per-element index updates plus a full rebuild.
+        let element_total: usize = results.iter().map(|(g, _)| g.elements.len()).sum();
+        let relationship_total: usize = results.iter().map(|(g, _)| g.relationships.len()).sum();
+        let mut builder = GraphBuilder::with_capacity(element_total, relationship_total);
         let mut all_diagnostics = Vec::new();
 
         for (graph, diagnostics) in results {
-            // Merge graphs - copy elements and relationships
-            for (_, element) in graph.elements {
-                combined_graph.add_element(element);
-            }
-            for (_, rel) in graph.relationships {
-                combined_graph.add_relationship(rel);
-            }
-
+            builder.extend_elements(graph.elements.into_values());
+            builder.extend_relationships(graph.relationships.into_values());
             all_diagnostics.extend(diagnostics);
         }
 
-        // Rebuild indexes after merging to ensure namespace_to_memberships
-        // and element_to_owning_membership indexes are populated
-        combined_graph.rebuild_indexes();
-
-        ParseResult::new(combined_graph, all_diagnostics)
+        ParseResult::new(builder.build(), all_diagnostics)
     }
 
     fn name(&self) -> &str {
@@ -547,4 +585,60 @@ mod tests {
         // Just verify it ran - specific validation behavior is tested elsewhere
         let _ = result.diagnostics.len();
     }
+
+    #[test]
+    fn lexical_errors_fail_fast_with_spans() {
+        let parser = PestParser::new();
+        let files = vec![SysmlFile::new("test.sysml", "package P { doc /* open")];
+        let result = parser.parse(&files);
+
+        assert!(result.has_errors());
+        let diag = &result.diagnostics[0];
+        assert!(diag.message.contains("unterminated comment"), "{}", diag);
+        assert!(diag.span.is_some());
+    }
+
+    #[test]
+    fn parallel_merge_matches_per_file_parses() {
+        let parser = PestParser::new();
+        let files: Vec<SysmlFile> = (0..8)
+            .map(|i| {
+                SysmlFile::new(
+                    format!("file{}.sysml", i),
+                    format!("package Pkg{} {{ part def Thing{}; }}", i, i),
+                )
+            })
+            .collect();
+
+        let combined = parser.parse(&files);
+        assert!(combined.is_ok());
+
+        // The parallel batch must contain exactly the union of per-file parses.
+        let mut expected = 0;
+        for file in &files {
+            expected += parser.parse(std::slice::from_ref(file)).graph.element_count();
+        }
+        assert_eq!(combined.graph.element_count(), expected);
+    }
+
+    #[test]
+    fn parallel_merge_keeps_diagnostics_in_input_order() {
+        let parser = PestParser::new();
+        let files = vec![
+            SysmlFile::new("bad_a.sysml", "package { broken"),
+            SysmlFile::new("ok.sysml", "package Fine { }"),
+            SysmlFile::new("bad_b.sysml", "part def {"),
+        ];
+        let result = parser.parse(&files);
+
+        let paths: Vec<&str> = result
+            .diagnostics
+            .iter()
+            .filter_map(|d| d.span.as_ref().map(|s| s.file.as_str()))
+            .collect();
+        let a = paths.iter().position(|p| *p == "bad_a.sysml");
+        let b = paths.iter().position(|p| *p == "bad_b.sysml");
+        assert!(a.is_some() && b.is_some(), "both files should diagnose");
+        assert!(a < b, "diagnostics should stay in input order");
+    }
 }
@@ -0,0 +1,104 @@
+//! Build script for sysml-ts.
+//!
+//! This script:
+//! 1. Compiles the generated tree-sitter C parser (tree-sitter/src/parser.c)
+//!    so the runtime can load the SysML grammar
+//! 2. Generates integer node-kind IDs from tree-sitter/src/node-types.json
+//!    for the compact syntax tree representation
+
+use std::env;
+use std::fs;
+use std::path::Path;
+
+fn main() {
+    let src_dir = Path::new("tree-sitter/src");
+
+    cc::Build::new()
+        .include(src_dir)
+        .file(src_dir.join("parser.c"))
+        .flag_if_supported("-w")
+        .compile("tree-sitter-sysml");
+
+    generate_node_kinds(src_dir);
+
+    println!("cargo:rerun-if-changed=tree-sitter/src/parser.c");
+    println!("cargo:rerun-if-changed=tree-sitter/src/tree_sitter/parser.h");
+    println!("cargo:rerun-if-changed=tree-sitter/src/node-types.json");
+    println!("cargo:rerun-if-changed=build.rs");
+}
+
+/// Generate `node_kinds.generated.rs`: one `u16` ID per named node kind,
+/// sorted by name so lookups can binary-search, plus an `ERROR` sentinel.
+fn generate_node_kinds(src_dir: &Path) {
+    let path = src_dir.join("node-types.json");
+    let json = fs::read_to_string(&path)
+        .unwrap_or_else(|e| panic!("Failed to read {:?}: {}", path, e));
+    let node_types: serde_json::Value = serde_json::from_str(&json)
+        .unwrap_or_else(|e| panic!("Failed to parse {:?}: {}", path, e));
+
+    let mut names: Vec<String> = node_types
+        .as_array()
+        .expect("node-types.json should be an array")
+        .iter()
+        .filter(|node| node["named"] == serde_json::Value::Bool(true))
+        .map(|node| {
+            node["type"]
+                .as_str()
+                .expect("node type should be a string")
+                .to_string()
+        })
+        .collect();
+    names.sort();
+    names.dedup();
+    assert!(
+        names.len() < u16::MAX as usize,
+        "too many node kinds for u16 IDs"
+    );
+
+    let mut out = String::new();
+    out.push_str("// Generated from tree-sitter/src/node-types.json. Do not edit by hand.\n\n");
+    out.push_str(&format!(
+        "/// Number of named node kinds in the grammar.\npub const NODE_KIND_COUNT: usize = {};\n\n",
+        names.len()
+    ));
+    out.push_str(&format!(
+        "/// Sentinel kind for error and missing nodes.\npub const ERROR: u16 = {};\n\n",
+        names.len()
+    ));
+    for (id, name) in names.iter().enumerate() {
+        out.push_str(&format!(
+            "pub const {}: u16 = {};\n",
+            name.to_uppercase(),
+            id
+        ));
+    }
+    out.push_str("\n/// Kind names, indexed by ID (the `ERROR` sentinel is last).\n");
+    out.push_str(&format!(
+        "pub static NODE_KIND_NAMES: [&str; {}] = [\n",
+        names.len() + 1
+    ));
+    for name in &names {
+        out.push_str(&format!("    \"{}\",\n", name));
+    }
+    out.push_str("    \"ERROR\",\n];\n\n");
+    out.push_str(
+        "/// Look up the ID for a named kind. `\"ERROR\"` maps to the sentinel.\n\
+         pub fn kind_id(name: &str) -> Option<u16> {\n\
+         \x20   if name == \"ERROR\" {\n\
+         \x20       return Some(ERROR);\n\
+         \x20   }\n\
+         \x20   NODE_KIND_NAMES[..NODE_KIND_COUNT]\n\
+         \x20       .binary_search(&name)\n\
+         \x20       .ok()\n\
+         \x20       .map(|i| i as u16)\n\
+         }\n\n\
+         /// The name of a kind ID.\n\
+         pub fn kind_name(id: u16) -> &'static str {\n\
+         \x20   NODE_KIND_NAMES[id as usize]\n\
+         }\n",
+    );
+
+    let out_dir = env::var("OUT_DIR").expect("OUT_DIR not set");
+    let out_path = Path::new(&out_dir).join("node_kinds.generated.rs");
+    fs::write(&out_path, out).unwrap_or_else(|e| panic!("Failed to write {:?}: {}", out_path, e));
+}
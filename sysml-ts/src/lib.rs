@@ -14,7 +14,13 @@
 //! **Note**: This crate intentionally does NOT depend on sysml-core.
 //! It deals only with syntax, not semantics.
 
-use sysml_span::Span;
+use sysml_span::{Span, Symbol};
+
+/// Integer node-kind IDs for the compact syntax tree, generated at build
+/// time from tree-sitter/src/node-types.json.
+pub mod kinds {
+    include!(concat!(env!("OUT_DIR"), "/node_kinds.generated.rs"));
+}
 
 /// A file to be parsed.
 #[derive(Debug, Clone)]
@@ -38,8 +44,9 @@ impl SysmlFile {
 /// A node in the concrete syntax tree.
 #[derive(Debug, Clone)]
 pub struct SyntaxNode {
-    /// The kind of this node (e.g., "package_declaration", "identifier").
-    pub kind: String,
+    /// The kind of this node (e.g., "package_declaration", "identifier"),
+    /// as an interned symbol: 4 bytes per node, O(1) comparison.
+    pub kind: Symbol,
     /// The source span of this node.
     pub span: Span,
     /// Child nodes.
@@ -50,7 +57,7 @@ pub struct SyntaxNode {
 
 impl SyntaxNode {
     /// Create a new syntax node.
-    pub fn new(kind: impl Into<String>, span: Span) -> Self {
+    pub fn new(kind: impl Into<Symbol>, span: Span) -> Self {
         SyntaxNode {
             kind: kind.into(),
             span,
@@ -62,7 +69,7 @@ impl SyntaxNode {
     /// Create an error node.
     pub fn error(span: Span) -> Self {
         SyntaxNode {
-            kind: "ERROR".to_string(),
+            kind: Symbol::intern("ERROR"),
             span,
             children: Vec::new(),
             is_error: true,
@@ -196,6 +203,392 @@ impl FastParser for StubTreeSitterParser {
     }
 }
 
+extern "C" {
+    /// Entry point of the generated C parser (tree-sitter/src/parser.c).
+    fn tree_sitter_sysml() -> tree_sitter::Language;
+}
+
+/// The tree-sitter language for SysML.
+pub fn language() -> tree_sitter::Language {
+    unsafe { tree_sitter_sysml() }
+}
+
+/// A byte-range edit, used to drive incremental reparsing.
+#[derive(Debug, Clone, Copy)]
+pub struct TextEdit {
+    /// Byte offset where the replaced region starts.
+    pub start: usize,
+    /// Byte offset where the replaced region ended in the old text.
+    pub old_end: usize,
+    /// Byte offset where the replacement ends in the new text.
+    pub new_end: usize,
+}
+
+/// Compute the tree-sitter point (row, column) for a byte offset.
+fn point_at(text: &str, offset: usize) -> tree_sitter::Point {
+    let prefix = &text.as_bytes()[..offset.min(text.len())];
+    let row = prefix.iter().filter(|b| **b == b'\n').count();
+    let line_start = prefix
+        .iter()
+        .rposition(|b| *b == b'\n')
+        .map(|pos| pos + 1)
+        .unwrap_or(0);
+    tree_sitter::Point::new(row, offset - line_start)
+}
+
+/// Cached parse state for one file.
+struct CachedTree {
+    tree: tree_sitter::Tree,
+    text: String,
+}
+
+/// The real tree-sitter parser, wired to the generated C grammar.
+///
+/// Produces the same [`SyntaxNode`] trees as the stub, but from the full
+/// grammar and with error recovery. Per-file trees are cached so
+/// [`TreeSitterParser::reparse`] can hand tree-sitter the edited old tree
+/// and only the changed region is re-lexed and re-parsed.
+pub struct TreeSitterParser {
+    /// Parser plus per-file tree cache; behind a mutex because the
+    /// tree-sitter parser needs `&mut` while [`FastParser`] takes `&self`.
+    state: std::sync::Mutex<ParserState>,
+    /// Maps the grammar's internal symbol IDs to the [`kinds`] IDs, so
+    /// compact-tree conversion never touches kind names.
+    kind_map: Vec<u16>,
+}
+
+struct ParserState {
+    parser: tree_sitter::Parser,
+    trees: std::collections::HashMap<String, CachedTree>,
+}
+
+impl TreeSitterParser {
+    /// Create a new parser for the SysML grammar.
+    ///
+    /// Panics only if the generated grammar is ABI-incompatible with the
+    /// linked tree-sitter runtime, which a build catches immediately.
+    pub fn new() -> Self {
+        let language = language();
+        let mut parser = tree_sitter::Parser::new();
+        parser
+            .set_language(&language)
+            .expect("generated SysML grammar should match the tree-sitter runtime ABI");
+
+        let mut kind_map = vec![kinds::ERROR; language.node_kind_count()];
+        for (ts_id, slot) in kind_map.iter_mut().enumerate() {
+            let ts_id = ts_id as u16;
+            if language.node_kind_is_named(ts_id) {
+                if let Some(id) = language.node_kind_for_id(ts_id).and_then(kinds::kind_id) {
+                    *slot = id;
+                }
+            }
+        }
+
+        TreeSitterParser {
+            state: std::sync::Mutex::new(ParserState {
+                parser,
+                trees: std::collections::HashMap::new(),
+            }),
+            kind_map,
+        }
+    }
+
+    /// Reparse a file after a byte-range edit.
+    ///
+    /// When a tree for `file.path` is cached, the edit is applied with
+    /// `ts_tree_edit` semantics and the old tree seeds the parse, so only
+    /// the changed region is reprocessed; otherwise this falls back to a
+    /// full parse. `file.text` must already contain the post-edit text.
+    pub fn reparse(&self, file: &SysmlFile, edit: TextEdit) -> SyntaxNode {
+        let mut state = self.state.lock().expect("parser mutex poisoned");
+        let old_tree = state.take_edited_tree(file, edit);
+        match state.parse_tree(file, old_tree.as_ref()) {
+            Some(tree) => convert_node(tree.root_node(), &file.path),
+            None => SyntaxNode::new("source_file", Span::new(&file.path, 0, file.text.len())),
+        }
+    }
+
+    /// Parse a file into a [`CompactTree`].
+    ///
+    /// Same caching behavior as [`FastParser::parse_cst`], but the result
+    /// is the flat integer-kind representation.
+    pub fn parse_compact(&self, file: &SysmlFile) -> CompactTree {
+        let mut state = self.state.lock().expect("parser mutex poisoned");
+        match state.parse_tree(file, None) {
+            Some(tree) => CompactTree::build(tree.root_node(), &file.path, &self.kind_map),
+            None => CompactTree::empty(&file.path, file.text.len()),
+        }
+    }
+
+    /// Reparse a file into a [`CompactTree`] after a byte-range edit.
+    ///
+    /// Same incremental behavior as [`TreeSitterParser::reparse`].
+    pub fn reparse_compact(&self, file: &SysmlFile, edit: TextEdit) -> CompactTree {
+        let mut state = self.state.lock().expect("parser mutex poisoned");
+        let old_tree = state.take_edited_tree(file, edit);
+        match state.parse_tree(file, old_tree.as_ref()) {
+            Some(tree) => CompactTree::build(tree.root_node(), &file.path, &self.kind_map),
+            None => CompactTree::empty(&file.path, file.text.len()),
+        }
+    }
+
+    /// Drop the cached tree for a closed file.
+    pub fn evict(&self, path: &str) {
+        self.state
+            .lock()
+            .expect("parser mutex poisoned")
+            .trees
+            .remove(path);
+    }
+}
+
+impl Default for TreeSitterParser {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl ParserState {
+    /// Parse `file`, cache the resulting tree, and return it.
+    ///
+    /// Returns `None` only when tree-sitter itself fails (cancellation or
+    /// a missing language); callers degrade to an empty root rather than
+    /// panicking mid-edit.
+    fn parse_tree(
+        &mut self,
+        file: &SysmlFile,
+        old_tree: Option<&tree_sitter::Tree>,
+    ) -> Option<tree_sitter::Tree> {
+        let tree = self.parser.parse(&file.text, old_tree)?;
+        self.trees.insert(
+            file.path.clone(),
+            CachedTree {
+                tree: tree.clone(),
+                text: file.text.clone(),
+            },
+        );
+        Some(tree)
+    }
+
+    /// Remove the cached tree for `file.path`, with `edit` applied so it
+    /// can seed an incremental reparse.
+    fn take_edited_tree(&mut self, file: &SysmlFile, edit: TextEdit) -> Option<tree_sitter::Tree> {
+        self.trees.remove(&file.path).map(|cached| {
+            let mut tree = cached.tree;
+            tree.edit(&tree_sitter::InputEdit {
+                start_byte: edit.start,
+                old_end_byte: edit.old_end,
+                new_end_byte: edit.new_end,
+                start_position: point_at(&cached.text, edit.start),
+                old_end_position: point_at(&cached.text, edit.old_end),
+                new_end_position: point_at(&file.text, edit.new_end),
+            });
+            tree
+        })
+    }
+}
+
+/// Convert a tree-sitter node (and its named descendants) to a SyntaxNode.
+fn convert_node(node: tree_sitter::Node, path: &str) -> SyntaxNode {
+    let span = Span::new(path, node.start_byte(), node.end_byte());
+    let mut converted = if node.is_error() || node.is_missing() {
+        SyntaxNode::error(span)
+    } else {
+        SyntaxNode::new(node.kind(), span)
+    };
+
+    let mut cursor = node.walk();
+    for child in node.named_children(&mut cursor) {
+        converted.children.push(convert_node(child, path));
+    }
+    converted
+}
+
+impl FastParser for TreeSitterParser {
+    fn parse_cst(&self, file: &SysmlFile) -> SyntaxNode {
+        let mut state = self.state.lock().expect("parser mutex poisoned");
+        match state.parse_tree(file, None) {
+            Some(tree) => convert_node(tree.root_node(), &file.path),
+            None => SyntaxNode::new("source_file", Span::new(&file.path, 0, file.text.len())),
+        }
+    }
+
+    fn supports_incremental(&self) -> bool {
+        true
+    }
+}
+
+/// A syntax tree stored as one flat arena.
+///
+/// Kinds are the `u16` IDs from [`kinds`] and each node's children occupy
+/// a contiguous index range, so tree walks are integer comparisons over a
+/// single allocation instead of per-node `String` kinds and child `Vec`s.
+/// For large files this is substantially cheaper to build and traverse
+/// than [`SyntaxNode`].
+#[derive(Debug, Clone)]
+pub struct CompactTree {
+    /// The file path, stored once for the whole tree.
+    path: String,
+    /// Nodes in breadth-first order; index 0 is the root.
+    nodes: Vec<CompactNode>,
+}
+
+#[derive(Debug, Clone, Copy)]
+struct CompactNode {
+    kind: u16,
+    start: u32,
+    end: u32,
+    /// Index range of this node's children in the arena.
+    children: (u32, u32),
+    is_error: bool,
+}
+
+impl CompactTree {
+    /// Build a compact tree from a tree-sitter tree, laying each node's
+    /// named children out contiguously.
+    fn build(ts_root: tree_sitter::Node, path: &str, kind_map: &[u16]) -> CompactTree {
+        let compact_of = |node: tree_sitter::Node| CompactNode {
+            kind: kind_map
+                .get(node.kind_id() as usize)
+                .copied()
+                .unwrap_or(kinds::ERROR),
+            start: node.start_byte() as u32,
+            end: node.end_byte() as u32,
+            children: (0, 0),
+            is_error: node.is_error() || node.is_missing(),
+        };
+
+        let mut nodes = vec![compact_of(ts_root)];
+        let mut queue = std::collections::VecDeque::from([(0usize, ts_root)]);
+        while let Some((index, ts_node)) = queue.pop_front() {
+            let first = nodes.len() as u32;
+            let mut cursor = ts_node.walk();
+            for child in ts_node.named_children(&mut cursor) {
+                queue.push_back((nodes.len(), child));
+                nodes.push(compact_of(child));
+            }
+            nodes[index].children = (first, nodes.len() as u32);
+        }
+
+        CompactTree {
+            path: path.to_string(),
+            nodes,
+        }
+    }
+
+    /// A tree holding only an empty `source_file` root.
+    fn empty(path: &str, len: usize) -> CompactTree {
+        CompactTree {
+            path: path.to_string(),
+            nodes: vec![CompactNode {
+                kind: kinds::SOURCE_FILE,
+                start: 0,
+                end: len as u32,
+                children: (1, 1),
+                is_error: false,
+            }],
+        }
+    }
+
+    /// The root node.
+    pub fn root(&self) -> CompactNodeRef<'_> {
+        CompactNodeRef {
+            tree: self,
+            index: 0,
+        }
+    }
+
+    /// Total number of nodes in the tree.
+    pub fn node_count(&self) -> usize {
+        self.nodes.len()
+    }
+
+    /// Whether any node in the tree is an error or missing node.
+    pub fn has_errors(&self) -> bool {
+        self.nodes.iter().any(|n| n.is_error)
+    }
+}
+
+/// A lightweight handle to a node in a [`CompactTree`].
+#[derive(Debug, Clone, Copy)]
+pub struct CompactNodeRef<'a> {
+    tree: &'a CompactTree,
+    index: u32,
+}
+
+impl<'a> CompactNodeRef<'a> {
+    fn node(&self) -> &'a CompactNode {
+        &self.tree.nodes[self.index as usize]
+    }
+
+    /// The kind ID of this node (see [`kinds`]).
+    pub fn kind_id(&self) -> u16 {
+        self.node().kind
+    }
+
+    /// The kind name of this node.
+    pub fn kind_name(&self) -> &'static str {
+        kinds::kind_name(self.node().kind)
+    }
+
+    /// The byte offset where this node starts.
+    pub fn start(&self) -> usize {
+        self.node().start as usize
+    }
+
+    /// The byte offset where this node ends.
+    pub fn end(&self) -> usize {
+        self.node().end as usize
+    }
+
+    /// The source span of this node.
+    pub fn span(&self) -> Span {
+        Span::new(&self.tree.path, self.start(), self.end())
+    }
+
+    /// Whether this node is an error or missing node.
+    pub fn is_error(&self) -> bool {
+        self.node().is_error
+    }
+
+    /// The text covered by this node.
+    pub fn text<'s>(&self, source: &'s str) -> &'s str {
+        &source[self.start()..self.end()]
+    }
+
+    /// Iterate over this node's children.
+    pub fn children(&self) -> impl Iterator<Item = CompactNodeRef<'a>> {
+        let (first, last) = self.node().children;
+        let tree = self.tree;
+        (first..last).map(move |index| CompactNodeRef { tree, index })
+    }
+
+    /// Find all descendants (including self) with the given kind ID.
+    pub fn find_by_kind(&self, kind: u16) -> Vec<CompactNodeRef<'a>> {
+        let mut found = Vec::new();
+        let mut stack = vec![*self];
+        while let Some(node) = stack.pop() {
+            if node.kind_id() == kind {
+                found.push(node);
+            }
+            // Push in reverse so children come off the stack in order.
+            let (first, last) = node.node().children;
+            for index in (first..last).rev() {
+                stack.push(CompactNodeRef {
+                    tree: node.tree,
+                    index,
+                });
+            }
+        }
+        found
+    }
+
+    /// Find the first direct child with the given kind ID.
+    pub fn child_by_kind(&self, kind: u16) -> Option<CompactNodeRef<'a>> {
+        self.children().find(|child| child.kind_id() == kind)
+    }
+}
+
 /// An outline item for IDE navigation.
 #[derive(Debug, Clone)]
 pub struct OutlineItem {
@@ -231,10 +624,30 @@ impl OutlineItem {
 pub fn extract_outline(root: &SyntaxNode, source: &str) -> Vec<OutlineItem> {
     let mut items = Vec::new();
 
-    for pkg in root.find_by_kind("package_declaration") {
-        if let Some(id) = pkg.child_by_kind("identifier") {
-            let name = id.text(source).to_string();
-            items.push(OutlineItem::new(name, "package", pkg.span.clone()));
+    // "package_decl" is the real grammar's rule name; "package_declaration"
+    // is what the stub parser emits.
+    for kind in ["package_decl", "package_declaration"] {
+        for pkg in root.find_by_kind(kind) {
+            if let Some(id) = pkg.child_by_kind("identifier") {
+                let name = id.text(source).to_string();
+                items.push(OutlineItem::new(name, "package", pkg.span.clone()));
+            }
+        }
+    }
+
+    items
+}
+
+/// Extract an outline from a compact CST.
+///
+/// Same result as [`extract_outline`], but the walk compares integer kind
+/// IDs over the flat arena instead of strings over a pointer tree.
+pub fn extract_outline_compact(tree: &CompactTree, source: &str) -> Vec<OutlineItem> {
+    let mut items = Vec::new();
+
+    for pkg in tree.root().find_by_kind(kinds::PACKAGE_DECL) {
+        if let Some(id) = pkg.child_by_kind(kinds::IDENTIFIER) {
+            items.push(OutlineItem::new(id.text(source), "package", pkg.span()));
         }
     }
 
@@ -314,6 +727,167 @@ mod tests {
         assert!(!packages.is_empty());
     }
 
+    #[test]
+    fn tree_sitter_parser_full_parse() {
+        let parser = TreeSitterParser::new();
+        let source = "package Vehicle {\n    part def Wheel;\n}\n";
+        let file = SysmlFile::new("test.sysml", source);
+        let cst = parser.parse_cst(&file);
+
+        assert_eq!(cst.kind, "source_file");
+        assert!(!cst.has_errors());
+        assert_eq!(cst.find_by_kind("package_decl").len(), 1);
+        assert_eq!(cst.find_by_kind("part_def").len(), 1);
+        assert!(parser.supports_incremental());
+    }
+
+    #[test]
+    fn tree_sitter_parser_reports_errors() {
+        let parser = TreeSitterParser::new();
+        let file = SysmlFile::new("test.sysml", "package {{{");
+        let cst = parser.parse_cst(&file);
+
+        assert!(cst.has_errors());
+    }
+
+    #[test]
+    fn tree_sitter_parser_incremental_reparse() {
+        let parser = TreeSitterParser::new();
+        let old_source = "package Vehicle {\n    part def Wheel;\n}\n";
+        parser.parse_cst(&SysmlFile::new("test.sysml", old_source));
+
+        // Rename Wheel -> Axle: bytes 31..36 replaced by 4 bytes.
+        let new_source = "package Vehicle {\n    part def Axle;\n}\n";
+        let start = old_source.find("Wheel").unwrap();
+        let file = SysmlFile::new("test.sysml", new_source);
+        let incremental = parser.reparse(
+            &file,
+            TextEdit {
+                start,
+                old_end: start + "Wheel".len(),
+                new_end: start + "Axle".len(),
+            },
+        );
+
+        let from_scratch = TreeSitterParser::new().parse_cst(&file);
+        assert_eq!(format!("{:?}", incremental), format!("{:?}", from_scratch));
+        assert!(!incremental.has_errors());
+    }
+
+    #[test]
+    fn compact_tree_matches_syntax_node_tree() {
+        let parser = TreeSitterParser::new();
+        let source = "package Vehicle {\n    part def Wheel;\n    part w : Wheel;\n}\n";
+        let file = SysmlFile::new("test.sysml", source);
+        let cst = parser.parse_cst(&file);
+        let compact = parser.parse_compact(&file);
+
+        fn count(node: &SyntaxNode) -> usize {
+            1 + node.children.iter().map(count).sum::<usize>()
+        }
+        assert_eq!(compact.node_count(), count(&cst));
+        assert_eq!(compact.root().kind_id(), kinds::SOURCE_FILE);
+        assert_eq!(compact.root().kind_name(), "source_file");
+        assert_eq!(compact.root().span(), cst.span);
+        assert!(!compact.has_errors());
+    }
+
+    #[test]
+    fn compact_tree_find_by_kind() {
+        let parser = TreeSitterParser::new();
+        let source = "package P {\n    part def A;\n    part def B;\n}\n";
+        let file = SysmlFile::new("test.sysml", source);
+        let compact = parser.parse_compact(&file);
+
+        let defs = compact.root().find_by_kind(kinds::PART_DEF);
+        assert_eq!(defs.len(), 2);
+        // Document order: A before B.
+        assert_eq!(
+            defs[0].child_by_kind(kinds::IDENTIFIER).unwrap().text(source),
+            "A"
+        );
+        assert_eq!(
+            defs[1].child_by_kind(kinds::IDENTIFIER).unwrap().text(source),
+            "B"
+        );
+    }
+
+    #[test]
+    fn compact_tree_marks_errors() {
+        let parser = TreeSitterParser::new();
+        let file = SysmlFile::new("test.sysml", "package {{{");
+        let compact = parser.parse_compact(&file);
+
+        assert!(compact.has_errors());
+    }
+
+    #[test]
+    fn compact_tree_incremental_reparse() {
+        let parser = TreeSitterParser::new();
+        let old_source = "package Vehicle {\n    part def Wheel;\n}\n";
+        parser.parse_compact(&SysmlFile::new("test.sysml", old_source));
+
+        let new_source = "package Vehicle {\n    part def Axle;\n}\n";
+        let start = old_source.find("Wheel").unwrap();
+        let file = SysmlFile::new("test.sysml", new_source);
+        let compact = parser.reparse_compact(
+            &file,
+            TextEdit {
+                start,
+                old_end: start + "Wheel".len(),
+                new_end: start + "Axle".len(),
+            },
+        );
+
+        let defs = compact.root().find_by_kind(kinds::PART_DEF);
+        assert_eq!(defs.len(), 1);
+        assert_eq!(
+            defs[0]
+                .child_by_kind(kinds::IDENTIFIER)
+                .unwrap()
+                .text(new_source),
+            "Axle"
+        );
+        assert!(!compact.has_errors());
+    }
+
+    #[test]
+    fn kind_id_round_trips() {
+        assert_eq!(kinds::kind_id("package_decl"), Some(kinds::PACKAGE_DECL));
+        assert_eq!(kinds::kind_name(kinds::PACKAGE_DECL), "package_decl");
+        assert_eq!(kinds::kind_id("ERROR"), Some(kinds::ERROR));
+        assert_eq!(kinds::kind_id("not_a_kind"), None);
+    }
+
+    #[test]
+    fn compact_outline_matches_syntax_node_outline() {
+        let parser = TreeSitterParser::new();
+        let source = "package MyPackage { }";
+        let file = SysmlFile::new("test.sysml", source);
+        let cst = parser.parse_cst(&file);
+        let compact = parser.parse_compact(&file);
+
+        let outline = extract_outline(&cst, source);
+        let compact_outline = extract_outline_compact(&compact, source);
+        assert_eq!(outline.len(), compact_outline.len());
+        assert_eq!(compact_outline[0].name, "MyPackage");
+        assert_eq!(compact_outline[0].kind, "package");
+        assert_eq!(compact_outline[0].span, outline[0].span);
+    }
+
+    #[test]
+    fn tree_sitter_outline_extraction() {
+        let parser = TreeSitterParser::new();
+        let source = "package MyPackage { }";
+        let file = SysmlFile::new("test.sysml", source);
+        let cst = parser.parse_cst(&file);
+        let outline = extract_outline(&cst, source);
+
+        assert_eq!(outline.len(), 1);
+        assert_eq!(outline[0].name, "MyPackage");
+        assert_eq!(outline[0].kind, "package");
+    }
+
     #[test]
     fn outline_extraction() {
         let parser = StubTreeSitterParser::new();